@@ -91,7 +91,8 @@ public class InstaLODMeshReduction : ModuleRules
             "ClothingSystemRuntimeCommon",
             "SkeletalMeshUtilitiesCommon",
             "RawMesh",
-            "MaterialUtilities"
+            "MaterialUtilities",
+            "Json"
         });
 
         PrivateIncludePathModuleNames.AddRange(new string[] {
@@ -47,6 +47,23 @@
 #include "Rendering/SkeletalMeshModel.h"
 #include "Rendering/SkeletalMeshLODModel.h"
 #include "InstaLOD/InstaLODMeshExtended.h"
+#include "InstaLOD/InstaLODResultCache.h"
+#include "InstaLOD/InstaLODExecutionContext.h"
+#include "InstaLOD/InstaLODLogSink.h"
+#include "InstaLOD/InstaLODMeshPool.h"
+#include "InstaLOD/InstaLODStats.h"
+#include "InstaLOD/InstaLODCapture.h"
+#include "InstaLOD/InstaLODTexturePageConversion.h"
+
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "Math/VectorRegister.h"
+#include "Hash/xxhash.h"
+#include "Misc/ScopeLock.h"
+
+#include <atomic>
 
 #define LOCTEXT_NAMESPACE "InstaLOD"
 
@@ -67,16 +84,123 @@ static TAutoConsoleVariable<int32> CVarProxyDeterministic(TEXT("InstaLOD.ProxyDe
 static TAutoConsoleVariable<float> CVarHLODScreenSizeFactor(TEXT("InstaLOD.HLODScreenSizeFactor"), 1.0f, TEXT("Controls the screen size based maximum deviation calculation."));
 static TAutoConsoleVariable<int32> CVarHLODRemesh(TEXT("InstaLOD.HLODRemesh"), 1, TEXT("Determines whether HLOD proxies use remeshing or mesh merging and optimize."));
 
+static TAutoConsoleVariable<int32> CVarLODCache(TEXT("InstaLOD.LODCache"), 0, TEXT("Enables the local cache of optimized meshes in the project's saved directory, cached meshes are only used if the stored input digest matches. Use 1 to enable the cache."));
+static TAutoConsoleVariable<int32> CVarLODCacheMaxSizeMB(TEXT("InstaLOD.LODCacheMaxSizeMB"), 2048, TEXT("Maximum size of the local cache of optimized meshes and proxies in megabytes. Least recently used entries are evicted first."));
+static TAutoConsoleVariable<int32> CVarHLODCache(TEXT("InstaLOD.HLODCache"), 0, TEXT("Enables the local cache of HLOD proxies in the project's saved directory, proxies are rebuilt only if their merge data, materials or settings changed. Cached proxies are only used if the stored input digest matches. Use 1 to enable the cache."));
+
+static TAutoConsoleVariable<int32> CVarParallelConversion(TEXT("InstaLOD.ParallelConversion"), 1, TEXT("Enables multi-threaded conversion of mesh data. Use 0 to force serial conversion for debugging."));
+static TAutoConsoleVariable<int32> CVarMeshPoolMaxRetainedMB(TEXT("InstaLOD.MeshPoolMaxRetainedMB"), 0, TEXT("Maximum size of the released InstaLOD meshes that are kept for reuse in megabytes, each mesh counts with its estimated size before it was cleared. The pool is trimmed to the peak amount of concurrently used meshes whenever no mesh is in use. The default of 0 deallocates released meshes immediately."));
+static TAutoConsoleVariable<int32> CVarParallelLODs(TEXT("InstaLOD.ParallelLODs"), 1, TEXT("Enables concurrent optimization of the LODs requested through ReduceMeshDescriptionLODs. The SDK message log is shared by all operations, captured logs of failed LODs can contain messages of other operations. Use 0 to optimize the LODs serially."));
+static TAutoConsoleVariable<int32> CVarHLODAsync(TEXT("InstaLOD.HLODAsync"), 0, TEXT("Builds proxies on a worker thread and completes them on the game thread, so that multiple proxies can be built at once. Commandlets always build proxies synchronously."));
+static TAutoConsoleVariable<int32> CVarConstantPageTolerance(TEXT("InstaLOD.ConstantPageTolerance"), 0, TEXT("Collapses texture pages of proxy and bake materials to a single texel if all texels match within this tolerance in 8-bit steps per channel. The default of 0 only collapses pages with identical texels, values above 0 are lossy. Normal maps of bake materials are never collapsed. Use -1 to keep all pages at full resolution."));
+
 static TAutoConsoleVariable<int32> CVarInstaDebug(TEXT("InstaLOD.Debug"), 0, TEXT("Internal debugging cvar."));
 static TAutoConsoleVariable<FString> CVarWriteOBJ(TEXT("InstaLOD.WriteOBJ"), TEXT(""), TEXT("Write a OBJ file containing a representation of the optimized mesh to the path specified in the cvar."));
+static TAutoConsoleVariable<int32> CVarLogStream(TEXT("InstaLOD.LogStream"), 1, TEXT("Forwards the output of the InstaLOD SDK to LogInstaLOD as it is written, each line lists the IDs of the operations that were running when it was written. Only available on Linux and Mac."));
+static TAutoConsoleVariable<FString> CVarCapture(TEXT("InstaLOD.Capture"), TEXT(""), TEXT("Captures the input meshes and resolved settings of reductions and proxies for offline replay with '-run=InstaLODReplay'. Use 1 to capture to the project's saved directory or specify a capture directory."));
 
 static TAutoConsoleVariable<int32> CVarAssertOnKeyMesh(TEXT("InstaLOD.AssertOnKeyMesh"), 0, TEXT("In case InstaLOD is not authorized while processing, InstaLOD for Unreal Engine will throw an error before adding the generated key mesh to the DDC."));
 static TAutoConsoleVariable<int32> CVarShowAuthorizationWindow(TEXT("InstaLOD.ShowAuthorizationWindow"), 1, TEXT("In case InstaLOD is not authorized on startup, InstaLOD for Unreal Engine will not show up the authorization window when starting Unreal Engine.\n"));
 
+TRACE_DECLARE_INT_COUNTER(InstaLODTrianglesIn, TEXT("InstaLOD/TrianglesIn"));
+TRACE_DECLARE_INT_COUNTER(InstaLODTrianglesOut, TEXT("InstaLOD/TrianglesOut"));
+TRACE_DECLARE_MEMORY_COUNTER(InstaLODBytesConverted, TEXT("InstaLOD/BytesConverted"));
+
 static const FString InstaLODAssertOnKeyMeshMessage("InstaLOD not authorized, 'InstaLOD.AssertOnKeyMesh' is enabled, stopping execution before generating key meshes.");
 
 namespace UEInstaLODMeshHelper
 {
+	/** The amount of elements processed by a single task when converting mesh data in parallel. */
+	static constexpr int32 kConversionChunkSize = 4096;
+
+	static inline bool IsParallelConversionDisabled()
+	{
+		return CVarParallelConversion.GetValueOnAnyThread() == 0;
+	}
+
+	/** Adds the size of the InstaLOD mesh to the converted bytes trace counter and records the conversion stats when the conversion scope is left. */
+	struct FScopedConversionSample
+	{
+		FScopedConversionSample(const EInstaLODStatsConversion InConversion, const InstaLOD::IInstaLODMesh *const InMesh) :
+		Conversion(InConversion),
+		Mesh(InMesh),
+		StartTime(FPlatformTime::Seconds())
+		{
+		}
+
+		~FScopedConversionSample()
+		{
+			const int64 MeshSizeInBytes = FInstaLODMeshPool::EstimateMeshSizeInBytes(Mesh);
+			TRACE_COUNTER_ADD(InstaLODBytesConverted, MeshSizeInBytes);
+			FInstaLODStats::RecordConversion(Conversion, FPlatformTime::Seconds() - StartTime, MeshSizeInBytes);
+		}
+
+		const EInstaLODStatsConversion Conversion;
+		const InstaLOD::IInstaLODMesh *const Mesh;
+		const double StartTime;
+	};
+
+	/**
+	 * Maps UE face and wedge indices to InstaLOD face and wedge indices.
+	 * NOTE: InstaLOD meshes use the opposite winding of UE meshes. Reversing the face and wedge arrays
+	 * is equivalent to IInstaLODMesh::ReverseFaceDirections without normal flipping, this allows
+	 * the converters to write and read corners in place instead of flipping the InstaLOD mesh.
+	 */
+	struct FWindingRemap
+	{
+		FWindingRemap(const uint32 InFaceCount, const bool bInReverse) :
+		FaceCount(InFaceCount),
+		WedgeCount(InFaceCount * 3u),
+		bReverse(bInReverse)
+		{}
+
+		inline uint32 Face(const uint32 FaceIndex) const
+		{
+			return bReverse ? FaceCount - 1u - FaceIndex : FaceIndex;
+		}
+
+		inline uint32 Wedge(const uint32 WedgeIndex) const
+		{
+			return bReverse ? WedgeCount - 1u - WedgeIndex : WedgeIndex;
+		}
+
+		/** Returns the first wedge of the remapped range [FirstWedgeIndex, EndWedgeIndex). */
+		inline uint32 WedgeRangeBegin(const uint32 FirstWedgeIndex, const uint32 EndWedgeIndex) const
+		{
+			return bReverse ? WedgeCount - EndWedgeIndex : FirstWedgeIndex;
+		}
+
+		const uint32 FaceCount;
+		const uint32 WedgeCount;
+		const bool bReverse;
+	};
+
+	/**
+	 * Specifies whether arrays of two attribute types share the same memory layout.
+	 * Layout compatible arrays are copied in bulk, all other types have to be converted element by element.
+	 */
+	template<typename A, typename B>
+	struct TIsLayoutCompatible
+	{
+		enum { Value = std::is_same<A, B>::value && std::is_trivially_copyable<A>::value };
+	};
+
+	template<> struct TIsLayoutCompatible<InstaLOD::InstaVec3F, FVector3f> { enum { Value = true }; };
+	template<> struct TIsLayoutCompatible<FVector3f, InstaLOD::InstaVec3F> { enum { Value = true }; };
+	template<> struct TIsLayoutCompatible<InstaLOD::InstaVec2F, FVector2f> { enum { Value = true }; };
+	template<> struct TIsLayoutCompatible<FVector2f, InstaLOD::InstaVec2F> { enum { Value = true }; };
+
+	static_assert(sizeof(InstaLOD::InstaVec3F) == sizeof(FVector3f) &&
+				  STRUCT_OFFSET(InstaLOD::InstaVec3F, X) == STRUCT_OFFSET(FVector3f, X) &&
+				  STRUCT_OFFSET(InstaLOD::InstaVec3F, Y) == STRUCT_OFFSET(FVector3f, Y) &&
+				  STRUCT_OFFSET(InstaLOD::InstaVec3F, Z) == STRUCT_OFFSET(FVector3f, Z), "InstaVec3F and FVector3f layout mismatch");
+	static_assert(sizeof(InstaLOD::InstaVec2F) == sizeof(FVector2f) &&
+				  STRUCT_OFFSET(InstaLOD::InstaVec2F, X) == STRUCT_OFFSET(FVector2f, X) &&
+				  STRUCT_OFFSET(InstaLOD::InstaVec2F, Y) == STRUCT_OFFSET(FVector2f, Y), "InstaVec2F and FVector2f layout mismatch");
+	static_assert(std::is_same<InstaLOD::uint32, uint32>::value && std::is_same<InstaLOD::InstaMaterialID, int32>::value, "InstaLOD index types differ from UE index types");
+	static_assert(std::is_trivially_copyable<InstaLOD::InstaVec3F>::value && std::is_trivially_copyable<InstaLOD::InstaVec2F>::value, "InstaLOD vector types must be trivially copyable");
+	static_assert(sizeof(InstaLOD::InstaColorRGBAF32) == sizeof(float) * 4 && STRUCT_OFFSET(InstaLOD::InstaColorRGBAF32, R) == 0, "InstaColorRGBAF32 is expected to be RGBA float");
+
 	static inline InstaLOD::InstaVec2F FVectorToInstaVec(const FVector2f& Vector)
 	{
 		InstaLOD::InstaVec2F OutVector;
@@ -113,14 +237,20 @@ namespace UEInstaLODMeshHelper
 		return OutQuaternion;
 	}
 	
+	/**
+	 * Converts a FColor to a InstaColorRGBAF32, this is identical to FColor::ReinterpretAsLinear.
+	 * NOTE: FColor is stored as BGRA, the channels are swizzled to RGBA after loading.
+	 */
+	static FORCEINLINE void FColorToInstaColorRGBAF32(const FColor& Color, InstaLOD::InstaColorRGBAF32& OutColor)
+	{
+		const VectorRegister4Float BGRA = VectorLoadByte4(&Color);
+		VectorStore(VectorDivide(VectorSwizzle(BGRA, 2, 1, 0, 3), VectorSetFloat1(255.0f)), &OutColor.R);
+	}
+
 	static inline InstaLOD::InstaColorRGBAF32 FColorToInstaColorRGBAF32(const FColor& Color)
 	{
-		const FLinearColor LinearColor = Color.ReinterpretAsLinear();
 		InstaLOD::InstaColorRGBAF32 OutColor;
-		OutColor.R = LinearColor.R;
-		OutColor.G = LinearColor.G;
-		OutColor.B = LinearColor.B;
-		OutColor.A = LinearColor.A;
+		FColorToInstaColorRGBAF32(Color, OutColor);
 		return OutColor;
 	}
 	
@@ -139,34 +269,47 @@ namespace UEInstaLODMeshHelper
 		return FVector3d(Vector.X, Vector.Y, Vector.Z);
 	}
 
-	static inline FColor InstaColorRGBAF32ToFColor(const InstaLOD::InstaColorRGBAF32& Color)
+	/**
+	 * Converts a InstaColorRGBAF32 to a FColor, this is identical to FLinearColor::ToFColor without sRGB conversion.
+	 * NOTE: the operand order of the clamp matches FMath::Clamp for NaN values on SSE.
+	 */
+	static FORCEINLINE void InstaColorRGBAF32ToFColor(const InstaLOD::InstaColorRGBAF32& Color, FColor& OutColor)
 	{
-		return FLinearColor(Color.R, Color.G, Color.B, Color.A).ToFColor(false);
+		const VectorRegister4Float RGBA = VectorMin(VectorMax(VectorZeroFloat(), VectorLoad(&Color.R)), VectorOneFloat());
+		VectorStoreByte4(VectorSwizzle(VectorMultiply(RGBA, VectorSetFloat1(255.999f)), 2, 1, 0, 3), &OutColor);
 	}
-	
-	static inline void FillArray(InstaLOD::InstaVec3F *const OutData, const FVector3f *const InData, const size_t NumElements)
+
+	static inline FColor InstaColorRGBAF32ToFColor(const InstaLOD::InstaColorRGBAF32& Color)
 	{
-		for(size_t Index=0; Index<NumElements; Index++)
-		{
-			OutData[Index].X = InData[Index].X;
-			OutData[Index].Y = InData[Index].Y;
-			OutData[Index].Z = InData[Index].Z;
-		}
+		FColor OutColor;
+		InstaColorRGBAF32ToFColor(Color, OutColor);
+		return OutColor;
 	}
 	
-	static inline void FillArray(InstaLOD::InstaVec2F *const OutData, const FVector2f *const InData, const size_t NumElements)
+	/** Copies an attribute array with a layout compatible element type in bulk. */
+	template<typename O, typename T>
+	static inline void FillArray(O *const OutData, const T *const InData, const size_t NumElements)
 	{
-		for(size_t Index =0; Index <NumElements; Index++)
+		static_assert(TIsLayoutCompatible<O, T>::Value, "Attribute types are not layout compatible and require a converter.");
+
+		if (NumElements > 0)
 		{
-			OutData[Index].X = InData[Index].X;
-			OutData[Index].Y = InData[Index].Y;
+			FMemory::Memcpy(OutData, InData, NumElements * sizeof(T));
 		}
 	}
 
-
+	/** Converts double precision texture coordinates, two coordinates are converted at a time. */
 	static inline void FillArray(InstaLOD::InstaVec2F* const OutData, const FVector2d* const InData, const size_t NumElements)
 	{
-		for (size_t Index=0; Index<NumElements; Index++)
+		size_t Index = 0;
+
+		for (; Index+2<=NumElements; Index+=2)
+		{
+			const VectorRegister4Double Value = VectorLoad(&InData[Index].X);
+			VectorStore(MakeVectorRegisterFloatFromDouble(Value), &OutData[Index].X);
+		}
+
+		for (; Index<NumElements; Index++)
 		{
 			OutData[Index].X = InData[Index].X;
 			OutData[Index].Y = InData[Index].Y;
@@ -175,106 +318,197 @@ namespace UEInstaLODMeshHelper
 
 	static inline void FillArray(InstaLOD::InstaColorRGBAF32 *const OutData, const FColor *const InData, const size_t NumElements)
 	{
-		for(size_t Index =0; Index <NumElements; Index++)
+		for (size_t Index=0; Index<NumElements; Index++)
 		{
-			FLinearColor color = InData[Index].ReinterpretAsLinear();
-			
-			OutData[Index].R = color.R;
-			OutData[Index].G = color.G;
-			OutData[Index].B = color.B;
-			OutData[Index].A = color.A;
+			FColorToInstaColorRGBAF32(InData[Index], OutData[Index]);
 		}
 	}
 	
-	template<typename T>
-	static inline void FillArray(T *const OutData, const T *const InData, const size_t NumElements)
+	/**
+	 * Replaces NaN and infinite values in the specified float array with the default value.
+	 * NOTE: it is possible that UE sends invalid data to InstaLOD that contains NaNs or infinite numbers
+	 * in order to avoid invalid meshes we sanitze all float arrays by default.
+	 * Elements are tested four at a time and written back only if a lane is invalid.
+	 *
+	 * @return the amount of sanitized values.
+	 */
+	static inline uint64 SanitizeFloatArray(float *const OutData, const size_t NumElements, const float InDefaultValue)
 	{
-		for(size_t Index=0; Index<NumElements; Index++)
+		const VectorRegister4Float MaxFiniteValue = VectorSetFloat1(MAX_flt);
+		const VectorRegister4Float DefaultValue = VectorSetFloat1(InDefaultValue);
+		uint64 InvalidCount = 0u;
+		size_t Index = 0;
+
+		for (; Index+4<=NumElements; Index+=4)
 		{
-			OutData[Index] = InData[Index];
+			const VectorRegister4Float Value = VectorLoad(OutData + Index);
+
+			// NOTE: comparisons with NaN always fail, so this mask is only set for finite lanes
+			const VectorRegister4Float FiniteMask = VectorCompareLE(VectorAbs(Value), MaxFiniteValue);
+			const uint32 FiniteBits = (uint32)VectorMaskBits(FiniteMask);
+
+			if (FiniteBits != 0xFu)
+			{
+				InvalidCount += 4u - FMath::CountBits(FiniteBits);
+				VectorStore(VectorSelect(FiniteMask, Value, DefaultValue), OutData + Index);
+			}
 		}
-	}
-	
-	static inline void SanitizeFloatArray(float *const OutData, const size_t NumElements, const float InDefaultValue)
-	{
-		// NOTE: it is possible that UE sends invalid data to InstaLOD that contains NaNs or infinite numbers
-		// in order to avoid invalid meshes we sanitze all float arrays by default
-		for(size_t Index=0; Index<NumElements; Index++)
+
+		for (; Index<NumElements; Index++)
 		{
-			if (FMath::IsNaN(OutData[Index]) || !FMath::IsFinite(OutData[Index]))
+			if (!FMath::IsFinite(OutData[Index]))
 			{
-				UE_LOG(LogInstaLOD, Warning, TEXT("Sanitzing NaN/infinite value in data received from Unreal Engine."));
 				OutData[Index] = InDefaultValue;
+				InvalidCount++;
 			}
 		}
+		return InvalidCount;
 	}
+
+	/** Identifies the attribute streams that are sanitized when converting meshes. */
+	enum class ESanitizeStream : uint8
+	{
+		Positions,
+		Normals,
+		Binormals,
+		Tangents,
+		TexCoords,
+		Colors,
+		Count
+	};
+
+	/** Aggregates the sanitized values per attribute stream, so that a single warning is emitted per stream. */
+	struct FSanitizeReport
+	{
+		FSanitizeReport()
+		{
+			for (std::atomic<uint64>& Count : Counts)
+			{
+				Count.store(0u, std::memory_order_relaxed);
+			}
+		}
+
+		void Add(const ESanitizeStream Stream, const uint64 Count)
+		{
+			if (Count > 0u)
+			{
+				Counts[(int32)Stream].fetch_add(Count, std::memory_order_relaxed);
+			}
+		}
+
+		void Sanitize(const ESanitizeStream Stream, void *const Data, const size_t NumElements, const float InDefaultValue = 0.0f)
+		{
+			Add(Stream, SanitizeFloatArray((float*)Data, NumElements, InDefaultValue));
+		}
+
+		void Log(const TCHAR *const Source) const
+		{
+			static const TCHAR *const kStreamNames[] = { TEXT("positions"), TEXT("normals"), TEXT("binormals"), TEXT("tangents"), TEXT("texture coordinates"), TEXT("colors") };
+			static_assert(UE_ARRAY_COUNT(kStreamNames) == (int32)ESanitizeStream::Count, "Stream names out of sync");
+
+			for (int32 StreamIndex=0; StreamIndex<(int32)ESanitizeStream::Count; StreamIndex++)
+			{
+				const uint64 Count = Counts[StreamIndex].load(std::memory_order_relaxed);
+
+				if (Count > 0u)
+				{
+					UE_LOG(LogInstaLOD, Warning, TEXT("Sanitized %llu NaN/infinite value(s) in %s %s received from Unreal Engine."), Count, Source, kStreamNames[StreamIndex]);
+				}
+			}
+		}
+
+		std::atomic<uint64> Counts[(int32)ESanitizeStream::Count];
+	};
 	
-	template<typename T>
-	static inline void FillTArray(TArray<T>& OutArray, const T *const InData, const size_t NumElements)
+	/** Replaces the contents of the array with a layout compatible attribute array in bulk. */
+	template<typename O, typename T>
+	static inline void FillTArray(TArray<O>& OutArray, const T *const InData, const size_t NumElements)
 	{
 		OutArray.Reset();
 		OutArray.AddUninitialized(NumElements);
-		for(size_t Index=0; Index<NumElements; Index++)
+		FillArray(OutArray.GetData(), InData, NumElements);
+	}
+
+	static inline void FillTArray(TArray<FColor>& OutArray, const InstaLOD::InstaColorRGBAF32 *const InData, const size_t NumElements)
+	{
+		OutArray.Reset();
+		OutArray.AddUninitialized(NumElements);
+
+		for (size_t Index=0; Index<NumElements; Index++)
 		{
-			OutArray[Index] = InData[Index];
+			InstaColorRGBAF32ToFColor(InData[Index], OutArray[Index]);
 		}
 	}
 	
 	template<typename T, typename O, O CONVERTER(const T&) >
 	static inline void FillTArrayWithConverter(TArray<O>& OutArray, const T *const InData, const size_t NumElements)
 	{
-		OutArray.Reset();
-		OutArray.AddUninitialized(NumElements);
-		
-		for(size_t Index=0; Index<NumElements; Index++)
+		if constexpr (TIsLayoutCompatible<O, T>::Value)
+		{
+			FillTArray(OutArray, InData, NumElements);
+		}
+		else
 		{
-			OutArray[Index] = CONVERTER(InData[Index]);
+			OutArray.Reset();
+			OutArray.AddUninitialized(NumElements);
+			
+			for(size_t Index=0; Index<NumElements; Index++)
+			{
+				OutArray[Index] = CONVERTER(InData[Index]);
+			}
 		}
 	}
 
 	static void InstaLODMeshToRawMesh(InstaLOD::IInstaLODMesh *const InstaMesh, FRawMesh& OutputMesh)
 	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UEInstaLODMeshHelper::InstaLODMeshToRawMesh);
+		FScopedConversionSample ConversionSample(EInstaLODStatsConversion::ConvertOut, InstaMesh);
 		OutputMesh.Empty();
 		
 		InstaLOD::uint64 ElementCount;
 		
+		// NOTE: all attributes except colors are layout compatible and copied in bulk
 		// per-vertex data
 		InstaLOD::InstaVec3F *const Vertices = InstaMesh->GetVertexPositions(&ElementCount);
-		UEInstaLODMeshHelper::FillTArrayWithConverter<InstaLOD::InstaVec3F, FVector3f, InstaVecToFVector>(OutputMesh.VertexPositions, Vertices, ElementCount);
+		UEInstaLODMeshHelper::FillTArray(OutputMesh.VertexPositions, Vertices, ElementCount);
 		
 		// per-wedge data
 		InstaLOD::uint32 *const WedgeIndices = InstaMesh->GetWedgeIndices(&ElementCount);
-		UEInstaLODMeshHelper::FillTArray<InstaLOD::uint32>(OutputMesh.WedgeIndices, WedgeIndices, ElementCount);
+		UEInstaLODMeshHelper::FillTArray(OutputMesh.WedgeIndices, WedgeIndices, ElementCount);
 		
 		InstaLOD::InstaVec3F *const WedgeTangents = InstaMesh->GetWedgeTangents(&ElementCount);
-		UEInstaLODMeshHelper::FillTArrayWithConverter<InstaLOD::InstaVec3F, FVector3f, InstaVecToFVector>(OutputMesh.WedgeTangentX, WedgeTangents, ElementCount);
+		UEInstaLODMeshHelper::FillTArray(OutputMesh.WedgeTangentX, WedgeTangents, ElementCount);
 		InstaLOD::InstaVec3F *const WedgeBinormals = InstaMesh->GetWedgeBinormals(&ElementCount);
-		UEInstaLODMeshHelper::FillTArrayWithConverter<InstaLOD::InstaVec3F, FVector3f, InstaVecToFVector>(OutputMesh.WedgeTangentY, WedgeBinormals, ElementCount);
+		UEInstaLODMeshHelper::FillTArray(OutputMesh.WedgeTangentY, WedgeBinormals, ElementCount);
 		InstaLOD::InstaVec3F *const WedgeNormals = InstaMesh->GetWedgeNormals(&ElementCount);
-		UEInstaLODMeshHelper::FillTArrayWithConverter<InstaLOD::InstaVec3F, FVector3f, InstaVecToFVector>(OutputMesh.WedgeTangentZ, WedgeNormals, ElementCount);
+		UEInstaLODMeshHelper::FillTArray(OutputMesh.WedgeTangentZ, WedgeNormals, ElementCount);
 		
 		InstaLOD::InstaColorRGBAF32 *const WedgeColors = InstaMesh->GetWedgeColors(0, &ElementCount);
-		UEInstaLODMeshHelper::FillTArrayWithConverter<InstaLOD::InstaColorRGBAF32, FColor, InstaColorRGBAF32ToFColor>(OutputMesh.WedgeColors, WedgeColors, ElementCount);
+		UEInstaLODMeshHelper::FillTArray(OutputMesh.WedgeColors, WedgeColors, ElementCount);
 		
 		// texture coordinate sets
 		const int32 TexCoordCount = FMath::Min<int>(InstaLOD::INSTALOD_MAX_MESH_TEXCOORDS, MAX_MESH_TEXTURE_COORDS);
 		for (size_t TexCoordSetIndex=0; TexCoordSetIndex<TexCoordCount; TexCoordSetIndex++)
 		{
 			InstaLOD::InstaVec2F *const TexCoords = InstaMesh->GetWedgeTexCoords(TexCoordSetIndex, &ElementCount);
-			UEInstaLODMeshHelper::FillTArrayWithConverter<InstaLOD::InstaVec2F, FVector2f, InstaVecToFVector>(OutputMesh.WedgeTexCoords[TexCoordSetIndex], TexCoords, ElementCount);
+			UEInstaLODMeshHelper::FillTArray(OutputMesh.WedgeTexCoords[TexCoordSetIndex], TexCoords, ElementCount);
 		}
 		
 		// per-face data
 		InstaLOD::InstaMaterialID *const FaceMaterialIndices = InstaMesh->GetFaceMaterialIndices(&ElementCount);
-		UEInstaLODMeshHelper::FillTArray<InstaLOD::InstaMaterialID>(OutputMesh.FaceMaterialIndices, FaceMaterialIndices, ElementCount);
+		UEInstaLODMeshHelper::FillTArray(OutputMesh.FaceMaterialIndices, FaceMaterialIndices, ElementCount);
 		
 		InstaLOD::uint32 *const FaceSmoothingGroups = InstaMesh->GetFaceSmoothingGroups(&ElementCount);
-		UEInstaLODMeshHelper::FillTArray<InstaLOD::uint32>(OutputMesh.FaceSmoothingMasks, FaceSmoothingGroups, ElementCount);
+		UEInstaLODMeshHelper::FillTArray(OutputMesh.FaceSmoothingMasks, FaceSmoothingGroups, ElementCount);
 	}
 	
 	static void MeshDescriptionToInstaLODMesh(const FMeshDescription& SourceMeshDescription, const TMap<FName, int32>& MaterialMapIn, InstaLOD::IInstaLODMesh *const InstaMesh)
 	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UEInstaLODMeshHelper::MeshDescriptionToInstaLODMesh);
+		FScopedConversionSample ConversionSample(EInstaLODStatsConversion::ConvertIn, InstaMesh);
 		InstaMesh->Clear();
+
+		const double T0 = FPlatformTime::Seconds();
 		
 		const FStaticMeshConstAttributes SourceMeshAttributes(SourceMeshDescription);
 		const TVertexAttributesConstRef<FVector3f> VertexPositions = SourceMeshAttributes.GetVertexPositions();
@@ -285,23 +519,44 @@ namespace UEInstaLODMeshHelper
 		const TVertexInstanceAttributesConstRef<FVector2f> VertexInstanceUVs = SourceMeshAttributes.GetVertexInstanceUVs();
 		const TPolygonGroupAttributesConstRef<FName> PolygonGroupMaterialSlotName = SourceMeshAttributes.GetPolygonGroupMaterialSlotNames();
 		
+		// NOTE: vertex IDs are dense unless vertices have been removed from the mesh description
+		// in that case the IDs are compacted once into a flat remap table, otherwise the raw element index is used
+		const uint32 VertexCount = SourceMeshDescription.Vertices().Num();
+		const int32 VertexArraySize = SourceMeshDescription.Vertices().GetArraySize();
+		const bool bHasSparseVertexIDs = VertexCount != (uint32)VertexArraySize;
+
+		UE_LOG(LogInstaLOD, Verbose, TEXT("Converting MeshDescription to InstaLOD mesh (%u vertices, %d vertex IDs, %d triangles, %d vertex instances)."),
+			   VertexCount, VertexArraySize, SourceMeshDescription.Triangles().Num(), SourceMeshDescription.VertexInstances().Num());
+
 		// set vertex positions 
-		InstaMesh->ResizeVertexPositions(SourceMeshDescription.Vertices().GetArraySize());
+		InstaMesh->ResizeVertexPositions(VertexCount);
 		InstaLOD::InstaVec3F *const OutVertexPositions = InstaMesh->GetVertexPositions(nullptr);
 
-		// lookup table to get from UE VertexId to VertexIndex
-		TMap<FVertexID, uint32> VertexIDToVertexIndex;
-		VertexIDToVertexIndex.Reserve(SourceMeshDescription.Vertices().GetArraySize());
+		// lookup table to get from UE VertexId to VertexIndex, only used if vertex IDs are sparse
+		TArray<uint32> VertexIDToVertexIndex;
+
+		if (bHasSparseVertexIDs)
+		{
+			VertexIDToVertexIndex.SetNumUninitialized(VertexArraySize);
 
-		uint32 VertexIndex = 0u;
-		for (const FVertexID& VertexID : SourceMeshDescription.Vertices().GetElementIDs())
+			uint32 VertexIndex = 0u;
+			for (const FVertexID VertexID : SourceMeshDescription.Vertices().GetElementIDs())
+			{
+				OutVertexPositions[VertexIndex] = UEInstaLODMeshHelper::FVectorToInstaVec(VertexPositions[VertexID]);
+				VertexIDToVertexIndex[VertexID.GetValue()] = VertexIndex;
+				VertexIndex++;
+			}
+		}
+		else
 		{
-			OutVertexPositions[VertexIndex] = UEInstaLODMeshHelper::FVectorToInstaVec(VertexPositions[VertexID]);
-			VertexIDToVertexIndex.Add(VertexID, VertexIndex);
-			VertexIndex++;
+			// dense vertex positions are copied in bulk from the raw attribute array
+			UEInstaLODMeshHelper::FillArray(OutVertexPositions, VertexPositions.GetRawArray().GetData(), VertexCount);
 		}
 
-		const uint32 VertexCount = VertexIndex;
+		const uint32 *const VertexIndexRemap = bHasSparseVertexIDs ? VertexIDToVertexIndex.GetData() : nullptr;
+
+		FSanitizeReport SanitizeReport;
+		SanitizeReport.Sanitize(ESanitizeStream::Positions, OutVertexPositions, VertexCount * 3u);
 		const uint32 TriangleCount = SourceMeshDescription.Triangles().Num();
 		const uint32 WedgeCount = TriangleCount * 3u;
 		const FVector4f White(FLinearColor::White);
@@ -348,142 +603,136 @@ namespace UEInstaLODMeshHelper
 		uint32 *const OutSmoothingGroups = InstaMesh->GetFaceSmoothingGroups(nullptr);
 		uint32 *const OutWedgeIndices = InstaMesh->GetWedgeIndices(nullptr);
 
-		// fill InstaLODMesh with data
-		uint32 TriangleIndex = 0u;
-		uint32 WedgeIndex = 0u;
+		// NOTE: corners are written in reversed order to convert the winding during the fill
+		const FWindingRemap Remap(TriangleCount, /*bReverse:*/ true);
+
+		// NOTE: the polygons are processed in chunks, a prefix sum over the per-polygon triangle counts
+		// provides the output face offset of each polygon so that chunks can be filled independently
+		const int32 PolygonCount = SourceMeshDescription.Polygons().Num();
+		TArray<FPolygonID> PolygonIDs;
+		TArray<uint32> PolygonTriangleOffsets;
+		PolygonIDs.Reserve(PolygonCount);
+		PolygonTriangleOffsets.Reserve(PolygonCount + 1);
+
+		uint32 TriangleOffset = 0u;
 		for (const FPolygonID PolygonID : SourceMeshDescription.Polygons().GetElementIDs())
 		{
-			const FPolygonGroupID& PolygonGroupID = SourceMeshDescription.GetPolygonPolygonGroup(PolygonID);
-			const int32 PolygonIDValue = PolygonID.GetValue();
-			const TArrayView<const FTriangleID>& TriangleIDs = SourceMeshDescription.GetPolygonTriangles(PolygonID);
+			PolygonIDs.Add(PolygonID);
+			PolygonTriangleOffsets.Add(TriangleOffset);
+			TriangleOffset += SourceMeshDescription.GetNumPolygonTriangles(PolygonID);
+		}
+		PolygonTriangleOffsets.Add(TriangleOffset);
+		check(TriangleOffset == TriangleCount);
+
+		// resolve the material index of each polygon group once
+		TArray<InstaLOD::InstaMaterialID> PolygonGroupMaterialIndices;
+		PolygonGroupMaterialIndices.SetNumZeroed(SourceMeshDescription.PolygonGroups().GetArraySize());
+
+		for (const FPolygonGroupID PolygonGroupID : SourceMeshDescription.PolygonGroups().GetElementIDs())
+		{
+			const int32 *const MaterialIndex = MaterialMapIn.Find(PolygonGroupMaterialSlotName[PolygonGroupID]);
+			PolygonGroupMaterialIndices[PolygonGroupID.GetValue()] = MaterialIndex != nullptr ? *MaterialIndex : PolygonGroupID.GetValue();
+		}
 
-			for (const FTriangleID TriangleID : TriangleIDs)
+		// fill InstaLODMesh with data
+		const auto FillPolygonRange = [&](const int32 FirstPolygonIndex, const int32 EndPolygonIndex)
+		{
+			for (int32 PolygonIndex=FirstPolygonIndex; PolygonIndex<EndPolygonIndex; PolygonIndex++)
 			{
-				for (uint32 TriangleCorner=0u; TriangleCorner<3u; TriangleCorner++)
+				const FPolygonID PolygonID = PolygonIDs[PolygonIndex];
+				const InstaLOD::InstaMaterialID MaterialIndex = PolygonGroupMaterialIndices[SourceMeshDescription.GetPolygonPolygonGroup(PolygonID).GetValue()];
+				uint32 UETriangleIndex = PolygonTriangleOffsets[PolygonIndex];
+				uint32 UEWedgeIndex = UETriangleIndex * 3u;
+
+				for (const FTriangleID TriangleID : SourceMeshDescription.GetPolygonTriangles(PolygonID))
 				{
-					const FVertexInstanceID VertexInstanceID = SourceMeshDescription.GetTriangleVertexInstance(TriangleID, TriangleCorner);
-					OutWedgeIndices[WedgeIndex] = VertexIDToVertexIndex[SourceMeshDescription.GetVertexInstanceVertex(VertexInstanceID)];
-					OutWedgeNormals[WedgeIndex] = UEInstaLODMeshHelper::FVectorToInstaVec(VertexInstanceNormals[VertexInstanceID]);
+					for (uint32 TriangleCorner=0u; TriangleCorner<3u; TriangleCorner++)
+					{
+						const uint32 WedgeIndex = Remap.Wedge(UEWedgeIndex++);
+						const FVertexInstanceID VertexInstanceID = SourceMeshDescription.GetTriangleVertexInstance(TriangleID, TriangleCorner);
+						const int32 VertexIDValue = SourceMeshDescription.GetVertexInstanceVertex(VertexInstanceID).GetValue();
+						OutWedgeIndices[WedgeIndex] = VertexIndexRemap != nullptr ? VertexIndexRemap[VertexIDValue] : (uint32)VertexIDValue;
+						OutWedgeNormals[WedgeIndex] = UEInstaLODMeshHelper::FVectorToInstaVec(VertexInstanceNormals[VertexInstanceID]);
 
-					const FVector3f Tangent = VertexInstanceTangents[VertexInstanceID];
-					OutWedgeTangents[WedgeIndex] = UEInstaLODMeshHelper::FVectorToInstaVec(Tangent);
-					OutWedgeBinormals[WedgeIndex] = UEInstaLODMeshHelper::FVectorToInstaVec(FVector3f::CrossProduct(VertexInstanceNormals[VertexInstanceID], Tangent).GetSafeNormal() * VertexInstanceBinormalSigns[VertexInstanceID] * -1.0f);
+						const FVector3f Tangent = VertexInstanceTangents[VertexInstanceID];
+						OutWedgeTangents[WedgeIndex] = UEInstaLODMeshHelper::FVectorToInstaVec(Tangent);
+						OutWedgeBinormals[WedgeIndex] = UEInstaLODMeshHelper::FVectorToInstaVec(FVector3f::CrossProduct(VertexInstanceNormals[VertexInstanceID], Tangent).GetSafeNormal() * VertexInstanceBinormalSigns[VertexInstanceID] * -1.0f);
 
-					for (uint32 UVChannelIndex=0u; UVChannelIndex<UVChannelCount; UVChannelIndex++)
-					{
-						WedgeUVChannels[UVChannelIndex][WedgeIndex] = UEInstaLODMeshHelper::FVectorToInstaVec(VertexInstanceUVs.Get(VertexInstanceID, UVChannelIndex));
-					}
+						for (uint32 UVChannelIndex=0u; UVChannelIndex<UVChannelCount; UVChannelIndex++)
+						{
+							WedgeUVChannels[UVChannelIndex][WedgeIndex] = UEInstaLODMeshHelper::FVectorToInstaVec(VertexInstanceUVs.Get(VertexInstanceID, UVChannelIndex));
+						}
 
-					if (bHasVertexColors)
-					{
-						OutWedgeColors[WedgeIndex] = UEInstaLODMeshHelper::FColorToInstaColorRGBAF32(FLinearColor(VertexInstanceColors[VertexInstanceID]).ToFColor(true));
+						if (bHasVertexColors)
+						{
+							OutWedgeColors[WedgeIndex] = UEInstaLODMeshHelper::FColorToInstaColorRGBAF32(FLinearColor(VertexInstanceColors[VertexInstanceID]).ToFColor(true));
+						}
 					}
 
-					WedgeIndex++;
-				}
+					const uint32 TriangleIndex = Remap.Face(UETriangleIndex++);
 
-				// set materialindex for triangle
-				if (MaterialMapIn.Contains(PolygonGroupMaterialSlotName[PolygonGroupID]))
-				{
-					OutMaterialIndices[TriangleIndex] = MaterialMapIn[PolygonGroupMaterialSlotName[PolygonGroupID]];
-				}
-				else
-				{
-					OutMaterialIndices[TriangleIndex] = PolygonGroupID.GetValue();
-				}
+					// set materialindex for triangle
+					OutMaterialIndices[TriangleIndex] = MaterialIndex;
 
-				// smoothing groups not supported set default value
-				OutSmoothingGroups[TriangleIndex] = 0u;
-				TriangleIndex++;
+					// smoothing groups not supported set default value
+					OutSmoothingGroups[TriangleIndex] = 0u;
+				}
 			}
-		}
+		};
 
-		// sanitize data
+		// sanitize the wedges of a chunk right after filling it while the data is still in cache
+		const auto SanitizeWedgeRange = [&](const uint32 FirstUEWedgeIndex, const uint32 EndUEWedgeIndex)
 		{
-			UEInstaLODMeshHelper::SanitizeFloatArray((float*)OutVertexPositions, VertexCount * 3u, 0.0f);
-			UEInstaLODMeshHelper::SanitizeFloatArray((float*)OutWedgeNormals, WedgeCount * 3u, 0.0f);
-			UEInstaLODMeshHelper::SanitizeFloatArray((float*)OutWedgeBinormals, WedgeCount * 3u, 0.0f);
-			UEInstaLODMeshHelper::SanitizeFloatArray((float*)OutWedgeTangents, WedgeCount * 3u, 0.0f);
+			const uint32 FirstWedgeIndex = Remap.WedgeRangeBegin(FirstUEWedgeIndex, EndUEWedgeIndex);
+			const uint32 RangeWedgeCount = EndUEWedgeIndex - FirstUEWedgeIndex;
+			SanitizeReport.Sanitize(ESanitizeStream::Normals, OutWedgeNormals + FirstWedgeIndex, RangeWedgeCount * 3u);
+			SanitizeReport.Sanitize(ESanitizeStream::Binormals, OutWedgeBinormals + FirstWedgeIndex, RangeWedgeCount * 3u);
+			SanitizeReport.Sanitize(ESanitizeStream::Tangents, OutWedgeTangents + FirstWedgeIndex, RangeWedgeCount * 3u);
 
 			for (uint32 UVChannelIndex=0u; UVChannelIndex<UVChannelCount; UVChannelIndex++)
 			{
-				UEInstaLODMeshHelper::SanitizeFloatArray((float*)WedgeUVChannels[UVChannelIndex], WedgeCount * 2u, 0.0f);
+				SanitizeReport.Sanitize(ESanitizeStream::TexCoords, WedgeUVChannels[UVChannelIndex] + FirstWedgeIndex, RangeWedgeCount * 2u);
 			}
 
 			if (bHasVertexColors)
 			{
-				UEInstaLODMeshHelper::SanitizeFloatArray((float*)OutWedgeColors, WedgeCount * 4u, 0.0f);
+				SanitizeReport.Sanitize(ESanitizeStream::Colors, OutWedgeColors + FirstWedgeIndex, RangeWedgeCount * 4u);
 			}
-		}
-		InstaMesh->ReverseFaceDirections(/*flipNormals:*/ false);
+		};
+
+		// NOTE: every wedge only depends on its own source data, the output is identical to the serial path
+		const int32 ChunkCount = FMath::DivideAndRoundUp(PolygonCount, kConversionChunkSize);
+		ParallelFor(ChunkCount, [&](const int32 ChunkIndex)
+		{
+			const int32 FirstPolygonIndex = ChunkIndex * kConversionChunkSize;
+			const int32 EndPolygonIndex = FMath::Min(FirstPolygonIndex + kConversionChunkSize, PolygonCount);
+			FillPolygonRange(FirstPolygonIndex, EndPolygonIndex);
+			SanitizeWedgeRange(PolygonTriangleOffsets[FirstPolygonIndex] * 3u, PolygonTriangleOffsets[EndPolygonIndex] * 3u);
+		}, IsParallelConversionDisabled());
+
+		SanitizeReport.Log(TEXT("mesh description"));
+
+		UE_LOG(LogInstaLOD, Verbose, TEXT("Converted MeshDescription to InstaLOD mesh (%u vertices, %u triangles, %s vertex IDs) in %.3fs."),
+			   VertexCount, TriangleCount, bHasSparseVertexIDs ? TEXT("remapped") : TEXT("dense"), (float)(FPlatformTime::Seconds() - T0));
 	}
 
-	static void InstaLODMeshToMeshDescription(InstaLOD::IInstaLODMesh *const InstaMesh, const TMap<int32, FName>& MaterialMapOut, FMeshDescription& DestinationMeshDescription)
+	static void InstaLODMeshToMeshDescription(InstaLOD::IInstaLODMesh *const InstaMesh, const TMap<int32, FName>& MaterialMapOut, FMeshDescription& DestinationMeshDescription,
+											  const EInstaLODWindingMode WindingMode = EInstaLODWindingMode::Convert)
 	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UEInstaLODMeshHelper::InstaLODMeshToMeshDescription);
+		FScopedConversionSample ConversionSample(EInstaLODStatsConversion::ConvertOut, InstaMesh);
 		check(InstaMesh);
 		DestinationMeshDescription.Empty();
 
-		InstaMesh->ReverseFaceDirections(/*flipNormals:*/ false);
-		
 		uint64 WedgeIndexCount = 0u;
 		uint64 VertexPositionCount = 0u;
 		const uint32 *const WedgeIndices = InstaMesh->GetWedgeIndices(&WedgeIndexCount);
 		const InstaLOD::InstaVec3F *const OutVertexPositions = InstaMesh->GetVertexPositions(&VertexPositionCount);
-		const uint64 TriangleCount = WedgeIndexCount / 3u;
-
-		// preallocate mesh description data
-		DestinationMeshDescription.ReserveNewVertices(VertexPositionCount);
-		DestinationMeshDescription.ReserveNewVertexInstances(WedgeIndexCount);
-		DestinationMeshDescription.ReserveNewPolygons(TriangleCount);
-		DestinationMeshDescription.ReserveNewEdges(TriangleCount*2.5f); // approx.
-		TVertexAttributesRef<FVector3f> VertexPositions = DestinationMeshDescription.VertexAttributes().GetAttributesRef<FVector3f>(MeshAttribute::Vertex::Position);
-		
-		// set vertex positions and create map to get from vertex index to vertexID
-		TMap<uint32, FVertexID> VertexIndexToVertexID;
-		VertexIndexToVertexID.Reserve(VertexPositionCount);
-
-		for (uint32 VertexIndex=0u; VertexIndex<VertexPositionCount; VertexIndex++)
-		{
-			const FVertexID VertexId = DestinationMeshDescription.CreateVertex();
-			VertexPositions.Set(VertexId, InstaVecToFVector(OutVertexPositions[VertexIndex]));
-			VertexIndexToVertexID.Add(VertexIndex, VertexId);
-		}
-		
-		// Array references for attributes
-		TAttributesSet<FVertexInstanceID>& InstanceAttributes = DestinationMeshDescription.VertexInstanceAttributes();
-		TVertexInstanceAttributesRef<FVector3f> VertexInstanceNormals = InstanceAttributes.GetAttributesRef<FVector3f>(MeshAttribute::VertexInstance::Normal);
-		TVertexInstanceAttributesRef<FVector3f> VertexInstanceTangents = InstanceAttributes.GetAttributesRef<FVector3f>(MeshAttribute::VertexInstance::Tangent);
-		TVertexInstanceAttributesRef<float> VertexInstanceBinormalSigns = InstanceAttributes.GetAttributesRef<float>(MeshAttribute::VertexInstance::BinormalSign);
-		TVertexInstanceAttributesRef<FVector4f> VertexInstanceColors = InstanceAttributes.GetAttributesRef<FVector4f>(MeshAttribute::VertexInstance::Color);
-		TVertexInstanceAttributesRef<FVector2f> VertexInstanceUVs = InstanceAttributes.GetAttributesRef<FVector2f>(MeshAttribute::VertexInstance::TextureCoordinate);
-		TPolygonGroupAttributesRef<FName> PolygonGroupImportedMaterialSlotNames = DestinationMeshDescription.PolygonGroupAttributes().GetAttributesRef<FName>(MeshAttribute::PolygonGroup::ImportedMaterialSlotName);
-
-		// clamp maximum texture coordinate channel to either InstaLOD max or unreal max
-		const int32 MaxTexCoordChannels = MAX_MESH_TEXTURE_COORDS > InstaLOD::INSTALOD_MAX_MESH_TEXCOORDS ? InstaLOD::INSTALOD_MAX_MESH_TEXCOORDS : MAX_MESH_TEXTURE_COORDS;
-		
-		TArray<int32> TextureCoordinateRemapIndex;
-		TextureCoordinateRemapIndex.AddZeroed(MaxTexCoordChannels);
-		
-		TArray<InstaLOD::InstaVec2F*> WedgeTextureCoordinates;
-		WedgeTextureCoordinates.Reserve(MaxTexCoordChannels);
+		const uint32 TriangleCount = (uint32)(WedgeIndexCount / 3u);
 
-		// map texture coordinates
-		int32 TexcoordsCount = 0;
-		for (int32 TextureCoordinateIndex=0; TextureCoordinateIndex<MaxTexCoordChannels; TextureCoordinateIndex++)
-		{
-			TextureCoordinateRemapIndex[TextureCoordinateIndex] = INDEX_NONE;
-			uint64 TexcoordCountInChannel = 0;
-			WedgeTextureCoordinates.Add(InstaMesh->GetWedgeTexCoords((uint64) TextureCoordinateIndex, &TexcoordCountInChannel));
-			
-			if (TexcoordCountInChannel == WedgeIndexCount)
-			{
-				TextureCoordinateRemapIndex[TextureCoordinateIndex] = TexcoordsCount;
-				TexcoordsCount++;
-			}
-		}
+		// NOTE: the InstaLOD mesh is not modified, corners are read in reversed order to convert the winding
+		const FWindingRemap Remap(TriangleCount, WindingMode == EInstaLODWindingMode::Convert);
 
-		VertexInstanceUVs.SetNumChannels(TexcoordsCount);
-		
 		// get wedge data from InstaLODMesh
 		uint64 WedgeColorCount = 0u;
 		uint64 WedgeTangentCount = 0u;
@@ -501,9 +750,43 @@ namespace UEInstaLODMeshHelper
 		const bool bHasColors = WedgeColorCount > 0u;
 		const bool bHasTangents = WedgeTangentCount > 0u && WedgeBinormalCount > 0u;
 		const bool bHasNormals = WedgeNormalCount > 0u;
-		
+
+		// collect all non-degenerate triangles, degenerates are skipped when building the mesh description
+		TArray<uint32> ValidTriangleIndices;
+		ValidTriangleIndices.Reserve(TriangleCount);
+
+		for (uint32 TriangleIndex=0u; TriangleIndex<TriangleCount; TriangleIndex++)
+		{
+			// NOTE: the corners of a face are contiguous in both orders, only their sequence differs
+			const uint32 *const Corners = WedgeIndices + Remap.Face(TriangleIndex) * 3u;
+
+			if (Corners[0] == Corners[1] || Corners[0] == Corners[2] || Corners[1] == Corners[2])
+				continue;
+
+			ValidTriangleIndices.Add(TriangleIndex);
+		}
+
+		const int32 ValidTriangleCount = ValidTriangleIndices.Num();
+		const int32 VertexInstanceCount = ValidTriangleCount * 3;
+
+		// preallocate mesh description data
+		DestinationMeshDescription.ReserveNewVertices(VertexPositionCount);
+		DestinationMeshDescription.ReserveNewVertexInstances(VertexInstanceCount);
+		DestinationMeshDescription.ReserveNewTriangles(ValidTriangleCount);
+		DestinationMeshDescription.ReserveNewPolygons(ValidTriangleCount);
+		DestinationMeshDescription.ReserveNewEdges(ValidTriangleCount*2.5f); // approx.
+
+		// NOTE: the mesh description is empty, element IDs are therefore created in order
+		// and the InstaLOD vertex index is identical to the vertex ID
+		for (uint32 VertexIndex=0u; VertexIndex<VertexPositionCount; VertexIndex++)
+		{
+			DestinationMeshDescription.CreateVertex();
+		}
+		check(DestinationMeshDescription.Vertices().GetArraySize() == (int32)VertexPositionCount);
+
+		TPolygonGroupAttributesRef<FName> PolygonGroupImportedMaterialSlotNames = DestinationMeshDescription.PolygonGroupAttributes().GetAttributesRef<FName>(MeshAttribute::PolygonGroup::ImportedMaterialSlotName);
+
 		// Materialindices are separated by polygongroups in Mesh Description
-		uint32 PolygonGroupIDSource = 0u;
 		TMap<int32, FPolygonGroupID> MaterialIndexToPolygonGroup;
 
 		for (uint32 FaceIndex=0u; FaceIndex<FaceMaterialIndexCount; FaceIndex++)
@@ -516,9 +799,9 @@ namespace UEInstaLODMeshHelper
 				DestinationMeshDescription.CreatePolygonGroupWithID(PolygonGroupID);
 
 				// use material map if index is set
-				if (MaterialMapOut.Contains(MaterialIndex))
+				if (const FName *const MaterialSlotName = MaterialMapOut.Find(MaterialIndex))
 				{
-					PolygonGroupImportedMaterialSlotNames.Set(PolygonGroupID, MaterialMapOut[MaterialIndex]);
+					PolygonGroupImportedMaterialSlotNames.Set(PolygonGroupID, *MaterialSlotName);
 				}
 				else
 				{
@@ -528,127 +811,121 @@ namespace UEInstaLODMeshHelper
 			}
 		}
 
-		// calculate the binormal sign
-		const auto fnCalculateBinormalSign = [](const FVector3f& Normal, const FVector3f& Binormal, const FVector3f& Tangent) -> float
-		{
-			const FVector3f CrossTangent = FVector3f::CrossProduct(Binormal, Normal);
-			return FVector3f::DotProduct(Tangent, CrossTangent) < 0 ? -1.0f : 1.0f;
-		};
+		// Triangles
+		// NOTE: faces are usually sorted by material, so the last polygon group lookup is cached
+		int32 LastMaterialIndex = INDEX_NONE;
+		FPolygonGroupID LastPolygonGroupID = INDEX_NONE;
+		FVertexInstanceID TriangleVertexInstanceIDs[3];
 
-		// Triangles 
-		FVertexID VertexIDs[3];
-		for (uint32 TriangleIndex=0u; TriangleIndex<TriangleCount; TriangleIndex++)
+		for (const uint32 TriangleIndex : ValidTriangleIndices)
 		{
-			const uint32 VertexFaceIndexBasis = TriangleIndex * 3u;
+			const int32 MaterialIndex = MaterialIndices[Remap.Face(TriangleIndex)];
 
-			// determine whether degenerates are present
-			for (uint32 CornerIndex=0u; CornerIndex<3u; CornerIndex++)
+			if (MaterialIndex != LastMaterialIndex || LastPolygonGroupID == INDEX_NONE)
 			{
-				const FVertexID VertexID = VertexIndexToVertexID[WedgeIndices[VertexFaceIndexBasis + CornerIndex]];
-				VertexIDs[CornerIndex] = VertexID;
+				LastPolygonGroupID = MaterialIndexToPolygonGroup.FindChecked(MaterialIndex);
+				LastMaterialIndex = MaterialIndex;
 			}
 
-			if (VertexIDs[0] == VertexIDs[1] || VertexIDs[0] == VertexIDs[2] || VertexIDs[1] == VertexIDs[2])
-				continue;
-
-			const int32 MaterialIndex = MaterialIndices[TriangleIndex];
-			FPolygonGroupID PolygonGroupID = INDEX_NONE;
-			FName PolygonGroupImportedMaterialSlotName = NAME_None;
-
-			if (MaterialIndexToPolygonGroup.Contains(MaterialIndex))
+			for (uint32 CornerIndex=0u; CornerIndex<3u; CornerIndex++)
 			{
-				PolygonGroupID = MaterialIndexToPolygonGroup[MaterialIndex];
-				PolygonGroupImportedMaterialSlotName = PolygonGroupImportedMaterialSlotNames[PolygonGroupID];
+				TriangleVertexInstanceIDs[CornerIndex] = DestinationMeshDescription.CreateVertexInstance(FVertexID(WedgeIndices[Remap.Wedge(TriangleIndex * 3u + CornerIndex)]));
 			}
-			else if (MaterialMapOut.Num() > 0 && MaterialMapOut.Contains(MaterialIndex))
-			{
-				PolygonGroupImportedMaterialSlotName = MaterialMapOut[MaterialIndex];
 
-				for (const FPolygonGroupID& SearchPolygonGroupID : DestinationMeshDescription.PolygonGroups().GetElementIDs())
-				{
-					if (PolygonGroupImportedMaterialSlotNames[SearchPolygonGroupID] == PolygonGroupImportedMaterialSlotName)
-					{
-						PolygonGroupID = SearchPolygonGroupID;
-						break;
-					}
-				}
-			}
+			DestinationMeshDescription.CreateTriangle(LastPolygonGroupID, MakeArrayView(TriangleVertexInstanceIDs, 3));
+		}
+		check(DestinationMeshDescription.VertexInstances().GetArraySize() == VertexInstanceCount);
 
-			if (PolygonGroupID == INDEX_NONE)
+		// clamp maximum texture coordinate channel to either InstaLOD max or unreal max
+		const int32 MaxTexCoordChannels = MAX_MESH_TEXTURE_COORDS > InstaLOD::INSTALOD_MAX_MESH_TEXCOORDS ? InstaLOD::INSTALOD_MAX_MESH_TEXCOORDS : MAX_MESH_TEXTURE_COORDS;
+
+		// map texture coordinates, only channels with a full set of wedges are transferred
+		TArray<const InstaLOD::InstaVec2F*> WedgeTextureCoordinates;
+		WedgeTextureCoordinates.Reserve(MaxTexCoordChannels);
+
+		for (int32 TextureCoordinateIndex=0; TextureCoordinateIndex<MaxTexCoordChannels; TextureCoordinateIndex++)
+		{
+			uint64 TexcoordCountInChannel = 0;
+			const InstaLOD::InstaVec2F *const TexCoords = InstaMesh->GetWedgeTexCoords((uint64) TextureCoordinateIndex, &TexcoordCountInChannel);
+			
+			if (TexcoordCountInChannel == WedgeIndexCount)
 			{
-				PolygonGroupID = DestinationMeshDescription.CreatePolygonGroup();
-				PolygonGroupImportedMaterialSlotNames.Set(PolygonGroupID, PolygonGroupImportedMaterialSlotName == NAME_None ? FName(*FString::Printf(TEXT("MaterialSlot_%d"), MaterialIndex)) : PolygonGroupImportedMaterialSlotName);
-				MaterialIndexToPolygonGroup.Add(MaterialIndex, PolygonGroupID);
+				WedgeTextureCoordinates.Add(TexCoords);
 			}
+		}
 
-			TArray<FVertexInstanceID> TriangleVertexInstanceIDs;
-			TriangleVertexInstanceIDs.SetNum(3);
-			const FVector3f ZeroVector = FVector3f(ForceInitToZero);
+		// write attributes straight into the raw attribute arrays
+		FStaticMeshAttributes DestinationMeshAttributes(DestinationMeshDescription);
+		TVertexInstanceAttributesRef<FVector2f> VertexInstanceUVs = DestinationMeshAttributes.GetVertexInstanceUVs();
+		VertexInstanceUVs.SetNumChannels(WedgeTextureCoordinates.Num());
 
-			for (uint32 CornerIndex=0u; CornerIndex<3u; CornerIndex++)
-			{
-				const uint32 WedgeIndex = VertexFaceIndexBasis + CornerIndex;
-				const uint32 VertexPositionIndex = WedgeIndices[WedgeIndex];
-				const FVertexID VertexID = VertexIndexToVertexID[VertexPositionIndex];
-				const FVertexInstanceID VertexInstanceID = DestinationMeshDescription.CreateVertexInstance(VertexID);
-				TriangleVertexInstanceIDs[CornerIndex] = VertexInstanceID;
+		const TArrayView<FVector3f> VertexPositions = DestinationMeshAttributes.GetVertexPositions().GetRawArray();
+		const TArrayView<FVector3f> VertexInstanceNormals = DestinationMeshAttributes.GetVertexInstanceNormals().GetRawArray();
+		const TArrayView<FVector3f> VertexInstanceTangents = DestinationMeshAttributes.GetVertexInstanceTangents().GetRawArray();
+		const TArrayView<float> VertexInstanceBinormalSigns = DestinationMeshAttributes.GetVertexInstanceBinormalSigns().GetRawArray();
+		const TArrayView<FVector4f> VertexInstanceColors = DestinationMeshAttributes.GetVertexInstanceColors().GetRawArray();
 
-				FLinearColor Color = FLinearColor::White;
-				FVector3f Normal = ZeroVector;
-				FVector3f Tangent = ZeroVector;
-				float Sign = 1.0f;
+		TArray<TArrayView<FVector2f>, TInlineAllocator<MAX_MESH_TEXTURE_COORDS>> VertexInstanceUVChannels;
+		for (int32 UVChannelIndex=0; UVChannelIndex<WedgeTextureCoordinates.Num(); UVChannelIndex++)
+		{
+			VertexInstanceUVChannels.Add(VertexInstanceUVs.GetRawArray(UVChannelIndex));
+		}
 
-				if (bHasNormals)
-				{
-					Normal = UEInstaLODMeshHelper::InstaVecToFVector(WedgeNormals[WedgeIndex]);
-				}
-				VertexInstanceNormals[VertexInstanceID] = Normal;
+		UEInstaLODMeshHelper::FillArray(VertexPositions.GetData(), OutVertexPositions, VertexPositionCount);
 
-				if (bHasTangents)
-				{
-					Tangent = UEInstaLODMeshHelper::InstaVecToFVector(WedgeTangents[WedgeIndex]);
-				}
-				VertexInstanceTangents[VertexInstanceID] = Tangent;
+		// calculate the binormal sign
+		const auto fnCalculateBinormalSign = [](const FVector3f& Normal, const FVector3f& Binormal, const FVector3f& Tangent) -> float
+		{
+			const FVector3f CrossTangent = FVector3f::CrossProduct(Binormal, Normal);
+			return FVector3f::DotProduct(Tangent, CrossTangent) < 0 ? -1.0f : 1.0f;
+		};
 
-				if (bHasTangents && bHasNormals)
-				{
-					const FVector3f Binormal = UEInstaLODMeshHelper::InstaVecToFVector(WedgeBinormals[WedgeIndex]);
-					Sign = fnCalculateBinormalSign(Normal, Binormal, Tangent);
-				}
-				VertexInstanceBinormalSigns[VertexInstanceID] = Sign;
+		const FVector3f ZeroVector = FVector3f(ForceInitToZero);
+		const FVector4f White(FLinearColor::White);
 
-				if (bHasColors)
-				{
-					Color = FLinearColor::FromSRGBColor(UEInstaLODMeshHelper::InstaColorRGBAF32ToFColor(WedgeColors[WedgeIndex]));
-				}
-				VertexInstanceColors[VertexInstanceID] = Color;
+		ParallelFor(FMath::DivideAndRoundUp(ValidTriangleCount, kConversionChunkSize), [&](const int32 ChunkIndex)
+		{
+			const int32 FirstValidTriangleIndex = ChunkIndex * kConversionChunkSize;
+			const int32 EndValidTriangleIndex = FMath::Min(FirstValidTriangleIndex + kConversionChunkSize, ValidTriangleCount);
+
+			for (int32 ValidTriangleIndex=FirstValidTriangleIndex; ValidTriangleIndex<EndValidTriangleIndex; ValidTriangleIndex++)
+			{
+				const uint32 VertexFaceIndexBasis = ValidTriangleIndices[ValidTriangleIndex] * 3u;
 
-				for (int32 TextureCoordinateIndex=0; TextureCoordinateIndex<TexcoordsCount; TextureCoordinateIndex++)
+				for (uint32 CornerIndex=0u; CornerIndex<3u; CornerIndex++)
 				{
-					const int32 TextureCoordinateIndexRemapped = TextureCoordinateRemapIndex[TextureCoordinateIndex];
+					const uint32 WedgeIndex = Remap.Wedge(VertexFaceIndexBasis + CornerIndex);
+					const int32 VertexInstanceIndex = ValidTriangleIndex * 3 + CornerIndex;
 
-					if (TextureCoordinateIndexRemapped == INDEX_NONE)
-						continue;
+					const FVector3f Normal = bHasNormals ? InstaVecToFVector(WedgeNormals[WedgeIndex]) : ZeroVector;
+					const FVector3f Tangent = bHasTangents ? InstaVecToFVector(WedgeTangents[WedgeIndex]) : ZeroVector;
+					VertexInstanceNormals[VertexInstanceIndex] = Normal;
+					VertexInstanceTangents[VertexInstanceIndex] = Tangent;
+					VertexInstanceBinormalSigns[VertexInstanceIndex] = bHasTangents && bHasNormals ? fnCalculateBinormalSign(Normal, InstaVecToFVector(WedgeBinormals[WedgeIndex]), Tangent) : 1.0f;
+					VertexInstanceColors[VertexInstanceIndex] = bHasColors ? FVector4f(FLinearColor::FromSRGBColor(InstaColorRGBAF32ToFColor(WedgeColors[WedgeIndex]))) : White;
 
-					VertexInstanceUVs.Set(VertexInstanceID, TextureCoordinateIndexRemapped, UEInstaLODMeshHelper::InstaVecToFVector(WedgeTextureCoordinates[TextureCoordinateIndex][WedgeIndex]));
+					for (int32 UVChannelIndex=0; UVChannelIndex<VertexInstanceUVChannels.Num(); UVChannelIndex++)
+					{
+						VertexInstanceUVChannels[UVChannelIndex][VertexInstanceIndex] = InstaVecToFVector(WedgeTextureCoordinates[UVChannelIndex][WedgeIndex]);
+					}
 				}
 			}
-			
-			TArray<FVertexInstanceID> TriangleVertexList;
-			TriangleVertexList.Add(TriangleVertexInstanceIDs[0]);
-			TriangleVertexList.Add(TriangleVertexInstanceIDs[1]);
-			TriangleVertexList.Add(TriangleVertexInstanceIDs[2]);
-			DestinationMeshDescription.CreateTriangle(PolygonGroupID, TriangleVertexList);
-		}
+		}, IsParallelConversionDisabled());
 
+		// NOTE: smoothing groups are indexed by polygon, so degenerate faces have to be removed here as well
 		TArray<uint32> SmoothingGroupArray;
-		SmoothingGroupArray.AddZeroed(TriangleCount);
+		SmoothingGroupArray.AddZeroed(ValidTriangleCount);
 
 		if (SmoothingGroupCount > 0u)
 		{
-			for (uint32 SmoothingGroupIndex=0u; SmoothingGroupIndex<SmoothingGroupCount; SmoothingGroupIndex++)
+			for (int32 ValidTriangleIndex=0; ValidTriangleIndex<ValidTriangleCount; ValidTriangleIndex++)
 			{
-				SmoothingGroupArray[SmoothingGroupIndex] = SmoothingGroups[SmoothingGroupIndex];
+				const uint32 TriangleIndex = Remap.Face(ValidTriangleIndices[ValidTriangleIndex]);
+
+				if (TriangleIndex < SmoothingGroupCount)
+				{
+					SmoothingGroupArray[ValidTriangleIndex] = SmoothingGroups[TriangleIndex];
+				}
 			}
 		}
 
@@ -791,37 +1068,171 @@ namespace UEInstaLODSkeletalMeshHelper
 		}
 		return SkipSections;
 	}
+
+	/**
+	 * A bone transform reduced to the upper 4x3 part of a UE matrix in single precision.
+	 * Each matrix row is stored in a vector register, the last lane is unused.
+	 */
+	struct FSkinningMatrix
+	{
+		VectorRegister4Float Rows[4];
+	};
+
+	template<typename T>
+	static inline FSkinningMatrix MakeSkinningMatrix(const UE::Math::TMatrix<T>& Matrix)
+	{
+		FSkinningMatrix OutMatrix;
+
+		for (int32 RowIndex=0; RowIndex<4; RowIndex++)
+		{
+			OutMatrix.Rows[RowIndex] = MakeVectorRegisterFloat((float)Matrix.M[RowIndex][0], (float)Matrix.M[RowIndex][1], (float)Matrix.M[RowIndex][2], 0.0f);
+		}
+		return OutMatrix;
+	}
+
+	/** Normalizes the first three components of the vector or returns a zero vector if the vector is too small, see FVector::GetSafeNormal. */
+	static FORCEINLINE VectorRegister4Float VectorSafeNormalize3(const VectorRegister4Float& Vector)
+	{
+		const VectorRegister4Float SizeSquared = VectorDot3(Vector, Vector);
+		const VectorRegister4Float NonZeroMask = VectorCompareGT(SizeSquared, VectorSetFloat1(UE_SMALL_NUMBER));
+		return VectorSelect(NonZeroMask, VectorMultiply(Vector, VectorReciprocalSqrtAccurate(SizeSquared)), VectorZeroFloat());
+	}
+
+	/** Flags set by BakePoseVertex in case a vertex could not be skinned as expected. */
+	enum EBakePoseVertexResult : uint32
+	{
+		BakePoseVertexResult_Success = 0u,
+		BakePoseVertexResult_InvalidWeights = 1u << 0,
+		BakePoseVertexResult_InvalidPosition = 1u << 1
+	};
+
+	/**
+	 * Blends the bone matrices of the vertex and transforms its position and tangent frame in place.
+	 * NOTE: bone indices of the vertex are section relative, SectionBoneMatrices are indexed via the section bone map.
+	 */
+	static uint32 BakePoseVertex(FSoftSkinVertex& Vertex, const FSkinningMatrix *const SectionBoneMatrices)
+	{
+		uint32 Result = BakePoseVertexResult_Success;
+		int32 TotalInfluence = 0;
+
+		// accumulate influences
+		for (int32 Index=0; Index<MAX_TOTAL_INFLUENCES; Index++)
+		{
+			TotalInfluence += (uint8)Vertex.InfluenceWeights[Index];
+		}
+
+		if (TotalInfluence != 255)
+		{
+			Result |= BakePoseVertexResult_InvalidWeights;
+		}
+
+		// calculate blended matrix
+		VectorRegister4Float BlendedRows[4] = { VectorZeroFloat(), VectorZeroFloat(), VectorZeroFloat(), VectorZeroFloat() };
+
+		if (TotalInfluence > 0)
+		{
+			for (int32 Index=0; Index<MAX_TOTAL_INFLUENCES; Index++)
+			{
+				const uint8 CurrentBoneInfluence = (uint8)Vertex.InfluenceWeights[Index];
+
+				if (CurrentBoneInfluence == 0)
+					continue;
+
+				const FSkinningMatrix& BoneMatrix = SectionBoneMatrices[(uint8)Vertex.InfluenceBones[Index]];
+				const VectorRegister4Float Weight = VectorSetFloat1(CurrentBoneInfluence/(float) TotalInfluence);
+
+				for (int32 RowIndex=0; RowIndex<4; RowIndex++)
+				{
+					BlendedRows[RowIndex] = VectorMultiplyAdd(BoneMatrix.Rows[RowIndex], Weight, BlendedRows[RowIndex]);
+				}
+			}
+		}
+
+		const auto TransformVector = [&BlendedRows](const float X, const float Y, const float Z)
+		{
+			return VectorMultiplyAdd(VectorSetFloat1(X), BlendedRows[0], VectorMultiplyAdd(VectorSetFloat1(Y), BlendedRows[1], VectorMultiply(VectorSetFloat1(Z), BlendedRows[2])));
+		};
+
+		// apply transformation to position and tangent frame in one pass
+		const VectorRegister4Float Position = VectorAdd(TransformVector(Vertex.Position.X, Vertex.Position.Y, Vertex.Position.Z), BlendedRows[3]);
+		const VectorRegister4Float TangentX = VectorSafeNormalize3(TransformVector(Vertex.TangentX.X, Vertex.TangentX.Y, Vertex.TangentX.Z));
+		const VectorRegister4Float TangentY = VectorSafeNormalize3(TransformVector(Vertex.TangentY.X, Vertex.TangentY.Y, Vertex.TangentY.Z));
+		const VectorRegister4Float TangentZ = VectorSafeNormalize3(TransformVector(Vertex.TangentZ.X, Vertex.TangentZ.Y, Vertex.TangentZ.Z));
+
+		FVector3f NewPosition;
+		VectorStoreFloat3(Position, &NewPosition.X);
+
+		if (NewPosition.ContainsNaN())
+		{
+			// keep the original vertex
+			return Result | BakePoseVertexResult_InvalidPosition;
+		}
+
+		const uint8 WComponent = FMath::Clamp(Vertex.TangentZ.W, 0, 255);
+		Vertex.Position = NewPosition;
+		VectorStoreFloat3(TangentX, &Vertex.TangentX.X);
+		VectorStoreFloat3(TangentY, &Vertex.TangentY.X);
+		VectorStoreFloat3(TangentZ, &Vertex.TangentZ.X);
+		Vertex.TangentZ.W = WComponent;
+		return Result;
+	}
 		
 	static void SkeletalLODModelToInstaLODMesh(const UE_StaticLODModel& SourceLODModel, InstaLOD::IInstaLODMesh *const InstaMesh, TArray<uint32>& SkipSections, UE_SkeletalBakePoseData *const BakePoseData = nullptr, const int32 LODIndex = -1)
 	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UEInstaLODSkeletalMeshHelper::SkeletalLODModelToInstaLODMesh);
+		UEInstaLODMeshHelper::FScopedConversionSample ConversionSample(EInstaLODStatsConversion::ConvertIn, InstaMesh);
 		using MatrixType = UE::Math::TMatrix<float>;
 
-		// build buffers
-		TArray<FSoftSkinVertex> Vertices;
-		SourceLODModel.GetVertices(Vertices);
+		const int32 SectionCount = SourceLODModel.Sections.Num();
 
-		// create a list of all valid section indices from the section indices which should be skipped
-		TArray<uint32> ValidSectionIndices;
-		for (uint32 SectionIndex=0u; SectionIndex<(uint32) SourceLODModel.Sections.Num(); SectionIndex++)
+		TBitArray<> SkippedSections(false, SectionCount);
+		for (const uint32 SkipSectionIndex : SkipSections)
 		{
-			if (SkipSections.Contains(SectionIndex))
-				continue;
-
-			ValidSectionIndices.Add(SectionIndex);
+			if (SkipSectionIndex < (uint32)SectionCount)
+			{
+				SkippedSections[SkipSectionIndex] = true;
+			}
 		}
 
+		// NOTE: a single pass over all sections collects the valid sections, the offset of each section in the
+		// InstaLOD vertex buffer and the amount of skipped vertices preceding the section in the UE index buffer
+		TArray<uint32> ValidSectionIndices;
+		TArray<uint32> SectionVertexOffsets;
+		TArray<uint32> SkippedVertexOffsets;
+		SectionVertexOffsets.SetNumUninitialized(SectionCount);
+		SkippedVertexOffsets.SetNumUninitialized(SectionCount);
+
 		uint32 VertexCount = 0u;
 		uint32 TriangleCount = 0u;
+		uint32 SkippedVertexCount = 0u;
 
-		// collect total triangle and vertex count from valid sections
-		for (uint32 SectionIndex : ValidSectionIndices)
+		for (int32 SectionIndex=0; SectionIndex<SectionCount; SectionIndex++)
 		{
 			const FSkelMeshSection& Section = SourceLODModel.Sections[SectionIndex];
+			SectionVertexOffsets[SectionIndex] = VertexCount;
+			SkippedVertexOffsets[SectionIndex] = SkippedVertexCount;
 
+			if (SkippedSections[SectionIndex])
+			{
+				SkippedVertexCount += Section.NumVertices;
+				continue;
+			}
+
+			ValidSectionIndices.Add(SectionIndex);
 			VertexCount += Section.NumVertices;
 			TriangleCount += Section.NumTriangles;
 		}
 
+		// NOTE: vertices are read straight from the sections, only a bake pose requires a copy of the valid vertices
+		TArray<FSoftSkinVertex> PosedVertices;
+
+		const auto GetSectionVertices = [&](const uint32 SectionIndex) -> const FSoftSkinVertex*
+		{
+			const FSkelMeshSection& Section = SourceLODModel.Sections[SectionIndex];
+			check(Section.SoftVertices.Num() >= (int32)Section.NumVertices);
+			return PosedVertices.Num() > 0 ? PosedVertices.GetData() + SectionVertexOffsets[SectionIndex] : Section.SoftVertices.GetData();
+		};
+
 		InstaMesh->Clear();
 
 		// setup per-vertex data buffers
@@ -854,6 +1265,7 @@ namespace UEInstaLODSkeletalMeshHelper
 			BakePoseData->ReferenceSkeleton != nullptr &&
 			BakePoseData->SkeletalMesh != nullptr)
 		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(UEInstaLODSkeletalMeshHelper::BakePose);
 			FMemMark Mark(FMemStack::Get());
 
 			const int32 NumBones=BakePoseData->SkeletalMesh->GetRefSkeleton().GetNum();
@@ -1027,106 +1439,81 @@ namespace UEInstaLODSkeletalMeshHelper
 			}
 #endif
 
-			TArray<float> BoneInfluences;
-			BoneInfluences.Reserve(MAX_TOTAL_INFLUENCES);
-			TArray<uint8> BoneIndices;
-			BoneIndices.Reserve(MAX_TOTAL_INFLUENCES);
+			// NOTE: matrices are converted once to single precision, the vertices of each section are then skinned in parallel
+			TArray<FSkinningMatrix> SkinningMatrices;
+			SkinningMatrices.SetNumUninitialized(NumBones);
+
+			for (int32 BoneIndex=0; BoneIndex<NumBones; BoneIndex++)
+			{
+				SkinningMatrices[BoneIndex] = MakeSkinningMatrix(RelativeToRefPoseMatrices[BoneIndex]);
+			}
+
+			std::atomic<uint32> InvalidWeightVertexCount(0u);
+			std::atomic<uint32> InvalidPositionVertexCount(0u);
+			TArray<FSkinningMatrix> SectionBoneMatrices;
+			PosedVertices.SetNumUninitialized(VertexCount);
 
 			for (const uint32 SectionIndex : ValidSectionIndices)
 			{
 				const FSkelMeshSection& Section = SourceLODModel.Sections[SectionIndex];
-				const uint32 EndVertexIndex = Section.BaseVertexIndex + Section.NumVertices;
 
-				for (uint32 VertexIndex=Section.BaseVertexIndex; VertexIndex<EndVertexIndex; VertexIndex++)
+				// resolve the section bone map once
+				SectionBoneMatrices.Reset();
+				for (const FBoneIndexType BoneIndex : Section.BoneMap)
 				{
-					FSoftSkinVertex& Vertex = Vertices[VertexIndex];
-					int32 TotalInfluence=0;
+					SectionBoneMatrices.Add(SkinningMatrices[BoneIndex]);
+				}
 
-					// accumulate influences
-					for (const uint8 Influence : Vertex.InfluenceWeights)
-					{
-						BoneInfluences.Add(Influence);
-						TotalInfluence += Influence;
-					}
+				const FSoftSkinVertex *const SectionVertices = Section.SoftVertices.GetData();
+				FSoftSkinVertex *const SectionPosedVertices = PosedVertices.GetData() + SectionVertexOffsets[SectionIndex];
+				const int32 SectionVertexCount = (int32)Section.NumVertices;
+				check(Section.SoftVertices.Num() >= SectionVertexCount);
 
-					if (TotalInfluence != 255)
-					{
-						UE_LOG(LogInstaLOD, Warning, TEXT("Skeletal mesh contains invalid weight distribution, please consider renormalizing weights."))
-					}
+				ParallelFor(FMath::DivideAndRoundUp(SectionVertexCount, UEInstaLODMeshHelper::kConversionChunkSize), [&](const int32 ChunkIndex)
+				{
+					const int32 FirstVertexIndex = ChunkIndex * UEInstaLODMeshHelper::kConversionChunkSize;
+					const int32 EndVertexIndex = FMath::Min(FirstVertexIndex + UEInstaLODMeshHelper::kConversionChunkSize, SectionVertexCount);
+					uint32 InvalidWeightCount = 0u;
+					uint32 InvalidPositionCount = 0u;
 
-					for (const uint8 boneIndex : Vertex.InfluenceBones)
+					for (int32 VertexIndex=FirstVertexIndex; VertexIndex<EndVertexIndex; VertexIndex++)
 					{
-						BoneIndices.Add(boneIndex);
+						SectionPosedVertices[VertexIndex] = SectionVertices[VertexIndex];
+						const uint32 Result = BakePoseVertex(SectionPosedVertices[VertexIndex], SectionBoneMatrices.GetData());
+						InvalidWeightCount += (Result & BakePoseVertexResult_InvalidWeights) != 0u ? 1u : 0u;
+						InvalidPositionCount += (Result & BakePoseVertexResult_InvalidPosition) != 0u ? 1u : 0u;
 					}
 
-					// Calculate blended matrix
-					FMatrix BlendedMatrix(ForceInitToZero);
-
-					if (TotalInfluence > 0)
-					{
-						for (int32 Index=0; Index<MAX_TOTAL_INFLUENCES; Index++)
-						{
-							const uint8 CurrentBoneIndex = Section.BoneMap[BoneIndices[Index]];
-							const float CurrentBoneInfluence = BoneInfluences[Index];
-
-							if (CurrentBoneInfluence > 0.0f)
-							{
-								BlendedMatrix += RelativeToRefPoseMatrices[CurrentBoneIndex] * (CurrentBoneInfluence/(float) TotalInfluence);
-							}
-						}
-					}
+					InvalidWeightVertexCount.fetch_add(InvalidWeightCount, std::memory_order_relaxed);
+					InvalidPositionVertexCount.fetch_add(InvalidPositionCount, std::memory_order_relaxed);
+				}, UEInstaLODMeshHelper::IsParallelConversionDisabled());
+			}
 
-					const auto fnVector3dToVector3f = [](const FVector3d& InVector)
-					{
-						return FVector3f(InVector.X, InVector.Y, InVector.Z);
-					};
-
-					// apply transformation to vertex
-					const FVector3f OldPosition = Vertex.Position;
-					const FVector3f OldTangentX = Vertex.TangentX;
-					const FVector3f OldTangentY = Vertex.TangentY;
-					const FVector3f OldTangentZ = Vertex.TangentZ;
-
-					const FVector3d Position = BlendedMatrix.TransformPosition(FVector3d(Vertex.Position));
-					Vertex.Position = fnVector3dToVector3f(Position);
-					const FVector3d WeightedTangentX = BlendedMatrix.TransformVector(FVector3d(Vertex.TangentX));
-					const FVector3d WeightedTangentY = BlendedMatrix.TransformVector(FVector3d(Vertex.TangentY));
-					const FVector3d WeightedTangentZ = BlendedMatrix.TransformVector(FVector3d(Vertex.TangentZ));
-
-					const uint8 WComponent = FMath::Clamp(Vertex.TangentZ.W, 0, 255);
-					Vertex.TangentX = fnVector3dToVector3f(WeightedTangentX.GetSafeNormal());
-					Vertex.TangentY = fnVector3dToVector3f(WeightedTangentY.GetSafeNormal());
-					Vertex.TangentZ = fnVector3dToVector3f(WeightedTangentZ.GetSafeNormal());
-					Vertex.TangentZ.W = WComponent;
-
-					if (Vertex.Position.ContainsNaN())
-					{
-						UE_LOG(LogInstaLOD, Warning, TEXT("Skeletal mesh Bake Pose calculation has invalid values."));
-						Vertex.Position = OldPosition;
-						Vertex.TangentX = OldTangentX;
-						Vertex.TangentY = OldTangentY;
-						Vertex.TangentZ = OldTangentZ;
-					}
+			if (InvalidWeightVertexCount.load() > 0u)
+			{
+				UE_LOG(LogInstaLOD, Warning, TEXT("Skeletal mesh contains invalid weight distribution for %u vertices, please consider renormalizing weights."), InvalidWeightVertexCount.load());
+			}
 
-					BoneInfluences.Reset();
-					BoneIndices.Reset();
-				}
+			if (InvalidPositionVertexCount.load() > 0u)
+			{
+				UE_LOG(LogInstaLOD, Warning, TEXT("Skeletal mesh Bake Pose calculation has invalid values for %u vertices."), InvalidPositionVertexCount.load());
 			}
 		}
 
 		// setup bone and vertex data 
 		InstaLOD::InstaVec3F *const OutVertexPositions = InstaMesh->GetVertexPositions(nullptr);
 
-		// index for InstaLOD vertex buffer
-		uint32 OutVertexIndex = 0u;
 		for (const uint32 ValidSectionIndex : ValidSectionIndices)
 		{
 			const FSkelMeshSection& Section = SourceLODModel.Sections[ValidSectionIndex];
-			const uint32 EndVertexIndex = Section.BaseVertexIndex + Section.NumVertices;
+			const FSoftSkinVertex *const SectionVertices = GetSectionVertices(ValidSectionIndex);
+
+			// index for InstaLOD vertex buffer
+			uint32 OutVertexIndex = SectionVertexOffsets[ValidSectionIndex];
 
-			for (uint32 VertexIndex=Section.BaseVertexIndex; VertexIndex<EndVertexIndex && VertexIndex < (uint32) Vertices.Num(); VertexIndex++, OutVertexIndex++)
+			for (uint32 VertexIndex=0u; VertexIndex<Section.NumVertices; VertexIndex++, OutVertexIndex++)
 			{
-				const FSoftSkinVertex& Vertex = Vertices[VertexIndex];
+				const FSoftSkinVertex& Vertex = SectionVertices[VertexIndex];
 				OutVertexPositions[OutVertexIndex] = UEInstaLODMeshHelper::FVectorToInstaVec(Vertex.Position);
 
 				// setup weights for this vertex
@@ -1146,7 +1533,9 @@ namespace UEInstaLODSkeletalMeshHelper
 		}
 
 		// setup wedge/face data
-		uint32 OutWedgeIndex=0u;
+		// NOTE: corners are written in reversed order to convert the winding during the fill
+		const UEInstaLODMeshHelper::FWindingRemap Remap(TriangleCount, /*bReverse:*/ true);
+		uint32 UEWedgeIndex = 0u;
 		InstaLOD::uint32* const OutWedgeIndices = InstaMesh->GetWedgeIndices(nullptr);
 		InstaLOD::InstaVec3F* const OutWedgeTangents = InstaMesh->GetWedgeTangents(nullptr);
 		InstaLOD::InstaVec3F* const OutWedgeBinormals = InstaMesh->GetWedgeBinormals(nullptr);
@@ -1161,38 +1550,24 @@ namespace UEInstaLODSkeletalMeshHelper
 
 		InstaLOD::uint32* const OutFaceSmoothingMasks = InstaMesh->GetFaceSmoothingGroups(nullptr);
 		InstaLOD::InstaMaterialID* const OutFaceMaterialIndices = InstaMesh->GetFaceMaterialIndices(nullptr);
-		uint32 OutFaceIndex = 0u;
+		uint32 UEFaceIndex = 0u;
 
 		constexpr int32 kDefaultSmoothingGroup = 1;
 
-		const auto SkippedIndexOffset=[](const TArray<FSkelMeshSection>& Sections, const TArray<uint32>& SkipSections, const uint32 SectionIndex) -> uint32
-		{
-			if (SectionIndex == 0u)
-				return 0u;
-
-			uint32 IndexOffset = 0u;
-			for (uint32 CurrentSectionIndex=0u; CurrentSectionIndex<SectionIndex; CurrentSectionIndex++)
-			{
-				if (!SkipSections.Contains(CurrentSectionIndex))
-					continue;
-
-				IndexOffset += Sections[CurrentSectionIndex].NumVertices;
-			}
-			return IndexOffset;
-		};
-
 		for (const uint32 ValidSectionIndex : ValidSectionIndices)
 		{
 			const FSkelMeshSection& Section = SourceLODModel.Sections[ValidSectionIndex];
-			const uint32 EndVertexIndex = Section.BaseVertexIndex + Section.NumVertices;
+			const FSoftSkinVertex *const SectionVertices = GetSectionVertices(ValidSectionIndex);
 			const uint32 SectionWedgeCount = Section.NumTriangles*3u;
-			const uint32 IndexOffset = SkippedIndexOffset(SourceLODModel.Sections, SkipSections, ValidSectionIndex);
+			const uint32 IndexOffset = SkippedVertexOffsets[ValidSectionIndex];
 
 			for (uint32 Index=0u; Index<SectionWedgeCount; Index++)
 			{
 				const int32 WedgeIndex = Section.BaseIndex + Index;
 				const uint32 VertexIndex = SourceLODModel.IndexBuffer[WedgeIndex];
-				const FSoftSkinVertex& Vertex = Vertices[VertexIndex];
+				checkSlow(VertexIndex >= Section.BaseVertexIndex && VertexIndex < Section.BaseVertexIndex + Section.NumVertices);
+				const FSoftSkinVertex& Vertex = SectionVertices[VertexIndex - Section.BaseVertexIndex];
+				const uint32 OutWedgeIndex = Remap.Wedge(UEWedgeIndex++);
 
 				OutWedgeIndices[OutWedgeIndex] = VertexIndex - IndexOffset;
 				OutWedgeNormals[OutWedgeIndex] = UEInstaLODMeshHelper::FVectorToInstaVec(Vertex.TangentZ);
@@ -1206,30 +1581,29 @@ namespace UEInstaLODSkeletalMeshHelper
 				}
 
 				OutWedgeColors[OutWedgeIndex] = UEInstaLODMeshHelper::FColorToInstaColorRGBAF32(Vertex.Color);
-				OutWedgeIndex++;
 			}
 
 			for (uint32 TriangleIndex=0u; TriangleIndex<Section.NumTriangles; TriangleIndex++)
 			{
+				const uint32 OutFaceIndex = Remap.Face(UEFaceIndex++);
 				OutFaceSmoothingMasks[OutFaceIndex] = kDefaultSmoothingGroup;
 				OutFaceMaterialIndices[OutFaceIndex] = Section.MaterialIndex;
-				OutFaceIndex++;
 			}
 		}
 
-		UEInstaLODMeshHelper::SanitizeFloatArray((float*) OutVertexPositions, VertexCount * 3, 0.0f);
-		UEInstaLODMeshHelper::SanitizeFloatArray((float*) OutWedgeNormals, WedgeCount * 3, 0.0f);
-		UEInstaLODMeshHelper::SanitizeFloatArray((float*) OutWedgeBinormals, WedgeCount * 3, 0.0f);
-		UEInstaLODMeshHelper::SanitizeFloatArray((float*) OutWedgeTangents, WedgeCount * 3, 0.0f);
+		UEInstaLODMeshHelper::FSanitizeReport SanitizeReport;
+		SanitizeReport.Sanitize(UEInstaLODMeshHelper::ESanitizeStream::Positions, OutVertexPositions, VertexCount * 3);
+		SanitizeReport.Sanitize(UEInstaLODMeshHelper::ESanitizeStream::Normals, OutWedgeNormals, WedgeCount * 3);
+		SanitizeReport.Sanitize(UEInstaLODMeshHelper::ESanitizeStream::Binormals, OutWedgeBinormals, WedgeCount * 3);
+		SanitizeReport.Sanitize(UEInstaLODMeshHelper::ESanitizeStream::Tangents, OutWedgeTangents, WedgeCount * 3);
 		
 		for (int32 TexcoordIndex=0; TexcoordIndex<TexcoordCount; TexcoordIndex++)
 		{
-			UEInstaLODMeshHelper::SanitizeFloatArray((float*) OutWedgeTexcoords[TexcoordIndex], WedgeCount * 2, 0.0f);
+			SanitizeReport.Sanitize(UEInstaLODMeshHelper::ESanitizeStream::TexCoords, OutWedgeTexcoords[TexcoordIndex], WedgeCount * 2);
 		}
 
-		UEInstaLODMeshHelper::SanitizeFloatArray((float*) OutWedgeColors, WedgeCount * 4, 0.0f);
-
-		InstaMesh->ReverseFaceDirections(/*flipNormals:*/ false);
+		SanitizeReport.Sanitize(UEInstaLODMeshHelper::ESanitizeStream::Colors, OutWedgeColors, WedgeCount * 4);
+		SanitizeReport.Log(TEXT("skeletal mesh"));
 	}
 
 	static bool ReferenceSkeletonToInstaLODSkeleton(const FReferenceSkeleton& ReferenceSkeleton, InstaLOD::IInstaLODSkeleton *const InstaSkeleton, TMap<int32, TPair<uint32, FString>>& OutUEBoneIndexToInstaLODBoneIndexAndName)
@@ -1274,11 +1648,11 @@ namespace UEInstaLODSkeletalMeshHelper
 
 	static void InstaLODMeshToSkeletalLODModel(InstaLOD::IInstaLODMesh *const InstaMesh, USkeletalMesh* SourceSkeletalMesh, UE_StaticLODModel& OutputLODModel, FSkeletalMeshImportData& ImportData, const IInstaLOD::UE_MeshBuildOptions &BuildOptions)
 	{ 
+		TRACE_CPUPROFILER_EVENT_SCOPE(UEInstaLODSkeletalMeshHelper::InstaLODMeshToSkeletalLODModel);
+		UEInstaLODMeshHelper::FScopedConversionSample ConversionSample(EInstaLODStatsConversion::ConvertOut, InstaMesh);
 		using namespace SkeletalMeshImportData;
 		check(InstaMesh != nullptr);
 		check(InstaMesh->IsValid());
-
-		InstaMesh->ReverseFaceDirections(/*flipNormals:*/ false);
 		
 		TArray<FVector3f> OutPoints;
 		TArray<FVertInfluence> OutInfluences;
@@ -1368,31 +1742,36 @@ namespace UEInstaLODSkeletalMeshHelper
 		OutFaces.AddUninitialized(FaceCount);
 		
 		static const FColor kDefaultColor(0, 0, 0, 255);
+
+		// NOTE: the InstaLOD mesh is not modified, corners are read in reversed order to convert the winding
+		const UEInstaLODMeshHelper::FWindingRemap Remap((uint32)FaceCount, /*bReverse:*/ true);
 		
 		for (uint32 FaceIndex=0u; FaceIndex<FaceCount; FaceIndex++)
 		{
 			FMeshFace &Face = OutFaces[FaceIndex];
+			const uint32 SourceFaceIndex = Remap.Face(FaceIndex);
 			
-			Face.MeshMaterialIndex = FaceMaterialIndices[FaceIndex];
-			Face.SmoothingGroups = FaceSmoothingGroups[FaceIndex];
+			Face.MeshMaterialIndex = FaceMaterialIndices[SourceFaceIndex];
+			Face.SmoothingGroups = FaceSmoothingGroups[SourceFaceIndex];
 			
 			// NOTE: this should unroll well
 			for (uint32 CornerIndex=0u; CornerIndex<3u; CornerIndex++)
 			{
 				const uint32 WedgeIndex = FaceIndex*3u + CornerIndex;
+				const uint32 SourceWedgeIndex = Remap.Wedge(WedgeIndex);
 				
 				Face.iWedge[CornerIndex] = WedgeIndex;
-				Face.TangentX[CornerIndex] = UEInstaLODMeshHelper::InstaVecToFVector(WedgeTangents[WedgeIndex]);
-				Face.TangentY[CornerIndex] = UEInstaLODMeshHelper::InstaVecToFVector(WedgeBinormals[WedgeIndex]);
-				Face.TangentZ[CornerIndex] = UEInstaLODMeshHelper::InstaVecToFVector(WedgeNormals[WedgeIndex]);
+				Face.TangentX[CornerIndex] = UEInstaLODMeshHelper::InstaVecToFVector(WedgeTangents[SourceWedgeIndex]);
+				Face.TangentY[CornerIndex] = UEInstaLODMeshHelper::InstaVecToFVector(WedgeBinormals[SourceWedgeIndex]);
+				Face.TangentZ[CornerIndex] = UEInstaLODMeshHelper::InstaVecToFVector(WedgeNormals[SourceWedgeIndex]);
 				
 				FMeshWedge &wedge = OutWedges[WedgeIndex];
-				wedge.Color = (WedgeColors == nullptr) ? kDefaultColor : UEInstaLODMeshHelper::InstaColorRGBAF32ToFColor(WedgeColors[WedgeIndex]);
-				wedge.iVertex = WedgeIndices[WedgeIndex];
+				wedge.Color = (WedgeColors == nullptr) ? kDefaultColor : UEInstaLODMeshHelper::InstaColorRGBAF32ToFColor(WedgeColors[SourceWedgeIndex]);
+				wedge.iVertex = WedgeIndices[SourceWedgeIndex];
 				
 				for (uint32 TexcoordIndex=0u; TexcoordIndex<TexcoordCount; TexcoordIndex++)
 				{
-					wedge.UVs[TexcoordIndex] = UEInstaLODMeshHelper::InstaVecToFVector(WedgeTexcoords[TexcoordIndex][WedgeIndex]);
+					wedge.UVs[TexcoordIndex] = UEInstaLODMeshHelper::InstaVecToFVector(WedgeTexcoords[TexcoordIndex][SourceWedgeIndex]);
 				}
 
 				for (uint32 TexcoordIndex=TexcoordCount; TexcoordIndex<MAX_TEXCOORDS; TexcoordIndex++)
@@ -1573,6 +1952,19 @@ FInstaLOD::FInstaLOD(InstaLOD::IInstaLOD *InstaLODAPI)
 {
 	InstaLOD = InstaLODAPI;
 	VersionString = InstaLODShared::Version;
+	LogSink = FInstaLODLogSink::Create(InstaLODAPI);
+	ExecutionContexts = MakeUnique<FInstaLODExecutionContextPool>(InstaLODAPI, LogSink.Get());
+	MeshPool = MakeUnique<FInstaLODMeshPool>(InstaLODAPI);
+}
+
+FInstaLOD::~FInstaLOD()
+{
+	// NOTE: asynchronous proxy builds access the execution contexts and the mesh pool
+	FScopeLock ScopeLock(&PendingProxyBuildsLock);
+	for (TFuture<void>& PendingProxyBuild : PendingProxyBuilds)
+	{
+		PendingProxyBuild.Wait();
+	}
 }
 
 void FInstaLOD::UnbindClothAtLODIndex(USkeletalMesh* SkeletalMesh, const int32 LODIndex)
@@ -1584,34 +1976,77 @@ void FInstaLOD::UnbindClothAtLODIndex(USkeletalMesh* SkeletalMesh, const int32 L
 	FLODUtilities::UnbindClothingAndBackup(SkeletalMesh, ClothingBindings, LODIndex);
 }
 
-void FInstaLOD::ReduceMeshDescription(FMeshDescription& OutReducedMesh, float& OutMaxDeviation, const FMeshDescription& InMesh,
-									  const FOverlappingCorners& InOverlappingCorners, const struct FMeshReductionSettings& ReductionSettings)
+InstaLOD::OptimizeResult FInstaLOD::OptimizeWithResultCache(FInstaLODExecutionContext& Context, const InstaLOD::IInstaLODMesh *const InstaMesh,
+																InstaLOD::IInstaLODMesh*& OutMesh, const InstaLOD::OptimizeSettings& OptimizeSettings)
 {
-	TMap<FName, int32> InMaterialMap;
-	TMap<int32, FName> OutMaterialMap;
-
-	UEInstaLODMeshHelper::CreateInputOutputMaterialMapFromMeshDescription(InMesh, InMaterialMap, OutMaterialMap);
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLOD::OptimizeWithResultCache);
+	const double T0 = FPlatformTime::Seconds();
 
-	InstaLOD::IInstaLODMesh* InstaMesh = AllocInstaLODMesh();
-	InstaLOD::IInstaLODMesh* OutMesh = AllocInstaLODMesh();
-	UEInstaLODMeshHelper::MeshDescriptionToInstaLODMesh(InMesh, InMaterialMap, InstaMesh);
-	InstaLOD::OptimizeSettings OptimizeSettings = UEInstaLODMeshHelper::ConvertMeshReductionSettingsToInstaLOD(ReductionSettings);
+	// NOTE: the request is captured even if it is served by the cache, so that the capture can be replayed
+	{
+		FInstaLODCapture Capture(CVarCapture.GetValueOnAnyThread(), FInstaLODCapture::EOperation::Optimize);
+		Capture.AddMesh(InstaMesh);
+		Capture.SetOptimizeSettings(OptimizeSettings);
+	}
 
-	InstaMesh->SanitizeMesh();
+	// NOTE: the cache is keyed by the final input mesh and settings, so it has to be queried after all modifications to the input mesh
+	const bool bUseResultCache = CVarLODCache.GetValueOnAnyThread() != 0 && OptimizeSettings.Skeleton == nullptr;
+	FInstaLODResultCache::FKey ResultCacheKey;
+	InstaLOD::OptimizeResult InstaResult;
+	bool bIsCachedResult = false;
 
-	if (OptimizeSettings.OptimizerVertexWeights)
+	if (bUseResultCache)
 	{
-		if (!InstaMesh->ConvertColorDataToOptimizerWeights(0))
+		ResultCacheKey = FInstaLODResultCache::ComputeKey(InstaLOD, InstaMesh, OptimizeSettings);
+
+		float CachedMeshDeviation = 0.0f;
+		if (InstaLOD::IInstaLODMesh *const CachedMesh = FInstaLODResultCache::Get().Load(InstaLOD, ResultCacheKey, CachedMeshDeviation))
 		{
-			UE_LOG(LogInstaLOD, Log, TEXT("Failed to convert color data to optimizer weights. Is color data available for mesh?"));
+			DeallocInstaLODMesh(OutMesh);
+			OutMesh = CachedMesh;
+			InstaResult.Success = true;
+			InstaResult.MeshDeviation = CachedMeshDeviation;
+			bIsCachedResult = true;
 		}
 	}
 	
-	const double T0 = FPlatformTime::Seconds();
-	
-	// generate optimized insta mesh
-	InstaLOD::OptimizeResult InstaResult = InstaLOD->Optimize(InstaMesh, OutMesh, OptimizeSettings);
-	
+	if (!bIsCachedResult)
+	{
+		// generate optimized insta mesh
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(InstaLOD::Optimize);
+			FInstaLODScopedStatsSample StatsSample(EInstaLODStatsOperation::Optimize);
+			// NOTE: a context can execute multiple optimizations during a single capture
+			const uint32 CapturedMessageCount = Context.GetCapturedMessageCount();
+			InstaResult = Context.GetOptimizeOperation()->Execute(InstaMesh, OutMesh, OptimizeSettings);
+			StatsSample.SetMeshes(InstaMesh, InstaResult.Success ? OutMesh : nullptr);
+			StatsSample.Sample.bSuccess = InstaResult.Success;
+			StatsSample.Sample.MessageCount = Context.GetCapturedMessageCount() - CapturedMessageCount;
+		}
+
+		// NOTE: key meshes generated without authorization must never be cached
+		if (bUseResultCache && InstaResult.Success && InstaResult.IsAuthorized)
+		{
+			const int64 MaxCacheSizeInBytes = (int64)FMath::Max(CVarLODCacheMaxSizeMB.GetValueOnAnyThread(), 0) * 1024 * 1024;
+			FInstaLODResultCache::Get().Store(OutMesh, ResultCacheKey, InstaResult.MeshDeviation, MaxCacheSizeInBytes);
+		}
+	}
+
+	UE_LOG(LogInstaLOD, Verbose, TEXT("Mesh reduction %s in %.3fs."), bIsCachedResult ? TEXT("loaded from LOD cache") : TEXT("computed"), (float)(FPlatformTime::Seconds() - T0));
+
+	InstaLOD::uint64 WedgeCount = 0u;
+	InstaMesh->GetWedgeIndices(&WedgeCount);
+	TRACE_COUNTER_SET(InstaLODTrianglesIn, (int64)(WedgeCount / 3u));
+	OutMesh->GetWedgeIndices(&WedgeCount);
+	TRACE_COUNTER_SET(InstaLODTrianglesOut, InstaResult.Success ? (int64)(WedgeCount / 3u) : 0);
+
+	return InstaResult;
+}
+
+void FInstaLOD::FinalizeReducedMesh(InstaLOD::IInstaLODMesh *const ResultMesh, InstaLOD::OptimizeResult& InstaResult, const FString& OptimizeLog,
+									const TMap<int32, FName>& OutMaterialMap, FMeshDescription& OutReducedMesh, float& OutMaxDeviation)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLOD::FinalizeReducedMesh);
 	if (CVarAssertOnKeyMesh.GetValueOnAnyThread() != 0)
 	{
 		if (!InstaResult.IsAuthorized)
@@ -1619,9 +2054,6 @@ void FInstaLOD::ReduceMeshDescription(FMeshDescription& OutReducedMesh, float& O
 			UE_LOG(LogInstaLOD, Fatal, TEXT("%s"), *InstaLODAssertOnKeyMeshMessage);
 		}
 	}
-
-	const double T1 = FPlatformTime::Seconds();
-	const float ElapsedTime = (float)(T1-T0);
 	
 	if (InstaResult.Success)
 	{
@@ -1631,21 +2063,14 @@ void FInstaLOD::ReduceMeshDescription(FMeshDescription& OutReducedMesh, float& O
 	}
 	else
 	{
-		char InstaLog[8192];
-		InstaLOD->GetMessageLog(InstaLog, sizeof(InstaLog), nullptr);
-		UE_LOG(LogInstaLOD, Error, TEXT("Optimization failed. Log: %s"), UTF8_TO_TCHAR(InstaLog));
+		UE_LOG(LogInstaLOD, Error, TEXT("Optimization failed. Log: %s"), *OptimizeLog);
 		OutMaxDeviation = 0;
-
-		// restore input mesh
-		InstaLOD::IInstaLODMesh *const Temp = InstaMesh;
-		InstaMesh = OutMesh;
-		OutMesh = Temp;
 	}
 	
 	if (CVarWriteOBJ.GetValueOnAnyThread().Len() > 0)
 	{
 		FText NotificationText;
-		if (OutMesh->WriteLightwaveOBJ(TCHAR_TO_UTF8(*CVarWriteOBJ.GetValueOnAnyThread())))
+		if (ResultMesh->WriteLightwaveOBJ(TCHAR_TO_UTF8(*CVarWriteOBJ.GetValueOnAnyThread())))
 		{
 			NotificationText = FText::Format(LOCTEXT("LODPluginWriteOBJSuccess", "Wrote Lightwave OBJ to \"{0}\""), FText::FromString(CVarWriteOBJ.GetValueOnAnyThread()));
 			DispatchNotification(NotificationText, SNotificationItem::CS_Success);
@@ -1659,12 +2084,141 @@ void FInstaLOD::ReduceMeshDescription(FMeshDescription& OutReducedMesh, float& O
 	}
 
 	// remove possible duplicates
-	InstaLOD->CastToInstaLODMeshExtended(OutMesh)->FixDuplicateVertexPositions(0.0f);
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(InstaLOD::FixDuplicateVertexPositions);
+		InstaLOD->CastToInstaLODMeshExtended(ResultMesh)->FixDuplicateVertexPositions(0.0f);
+	}
 	
-	UEInstaLODMeshHelper::InstaLODMeshToMeshDescription(OutMesh, OutMaterialMap, OutReducedMesh);
+	UEInstaLODMeshHelper::InstaLODMeshToMeshDescription(ResultMesh, OutMaterialMap, OutReducedMesh);
+}
+
+void FInstaLOD::ReduceMeshDescription(FMeshDescription& OutReducedMesh, float& OutMaxDeviation, const FMeshDescription& InMesh,
+									  const FOverlappingCorners& InOverlappingCorners, const struct FMeshReductionSettings& ReductionSettings)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLOD::ReduceMeshDescription);
+	TMap<FName, int32> InMaterialMap;
+	TMap<int32, FName> OutMaterialMap;
+
+	UEInstaLODMeshHelper::CreateInputOutputMaterialMapFromMeshDescription(InMesh, InMaterialMap, OutMaterialMap);
+
+	InstaLOD::IInstaLODMesh* InstaMesh = AllocInstaLODMesh();
+	InstaLOD::IInstaLODMesh* OutMesh = AllocInstaLODMesh();
+	UEInstaLODMeshHelper::MeshDescriptionToInstaLODMesh(InMesh, InMaterialMap, InstaMesh);
+	InstaLOD::OptimizeSettings OptimizeSettings = UEInstaLODMeshHelper::ConvertMeshReductionSettingsToInstaLOD(ReductionSettings);
+
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(InstaLOD::SanitizeMesh);
+		InstaMesh->SanitizeMesh();
+	}
+
+	if (OptimizeSettings.OptimizerVertexWeights)
+	{
+		if (!InstaMesh->ConvertColorDataToOptimizerWeights(0))
+		{
+			UE_LOG(LogInstaLOD, Log, TEXT("Failed to convert color data to optimizer weights. Is color data available for mesh?"));
+		}
+	}
+
+	FInstaLODScopedExecutionContext Context(*ExecutionContexts);
+	InstaLOD::OptimizeResult InstaResult = OptimizeWithResultCache(*Context, InstaMesh, OutMesh, OptimizeSettings);
+	const FString OptimizeLog = InstaResult.Success ? FString() : Context->GetCapturedLog();
+
+	// NOTE: the input mesh is used as result if the optimization failed
+	FinalizeReducedMesh(InstaResult.Success ? OutMesh : InstaMesh, InstaResult, OptimizeLog, OutMaterialMap, OutReducedMesh, OutMaxDeviation);
+
+	DeallocInstaLODMesh(InstaMesh);
+	DeallocInstaLODMesh(OutMesh);
+}
+
+bool FInstaLOD::ReduceMeshDescriptionLODs(const FMeshDescription& InMesh, const TArray<FMeshReductionSettings>& ReductionSettings,
+										  TArray<FMeshDescription>& OutReducedMeshes, TArray<float>& OutMaxDeviations)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLOD::ReduceMeshDescriptionLODs);
+	const int32 LODCount = ReductionSettings.Num();
+
+	OutReducedMeshes.Reset(LODCount);
+	OutReducedMeshes.SetNum(LODCount);
+	OutMaxDeviations.Reset(LODCount);
+	OutMaxDeviations.SetNumZeroed(LODCount);
+
+	if (LODCount == 0)
+		return true;
+
+	TMap<FName, int32> InMaterialMap;
+	TMap<int32, FName> OutMaterialMap;
+
+	UEInstaLODMeshHelper::CreateInputOutputMaterialMapFromMeshDescription(InMesh, InMaterialMap, OutMaterialMap);
+
+	TArray<InstaLOD::OptimizeSettings> OptimizeSettings;
+	OptimizeSettings.Reserve(LODCount);
+	bool bRequiresOptimizerWeights = false;
+
+	for (const FMeshReductionSettings& Settings : ReductionSettings)
+	{
+		OptimizeSettings.Add(UEInstaLODMeshHelper::ConvertMeshReductionSettingsToInstaLOD(Settings));
+		bRequiresOptimizerWeights |= OptimizeSettings.Last().OptimizerVertexWeights;
+	}
+
+	// NOTE: the input mesh is converted and sanitized once and shared by all optimizations,
+	// optimizer weights are ignored by the optimizer for LODs that don't enable them
+	InstaLOD::IInstaLODMesh *const InstaMesh = AllocInstaLODMesh();
+	UEInstaLODMeshHelper::MeshDescriptionToInstaLODMesh(InMesh, InMaterialMap, InstaMesh);
+
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(InstaLOD::SanitizeMesh);
+		InstaMesh->SanitizeMesh();
+	}
+
+	if (bRequiresOptimizerWeights)
+	{
+		if (!InstaMesh->ConvertColorDataToOptimizerWeights(0))
+		{
+			UE_LOG(LogInstaLOD, Log, TEXT("Failed to convert color data to optimizer weights. Is color data available for mesh?"));
+		}
+	}
+
+	TArray<InstaLOD::IInstaLODMesh*> OutMeshes;
+	TArray<InstaLOD::OptimizeResult> InstaResults;
+	TArray<FString> OptimizeLogs;
+	OutMeshes.SetNumZeroed(LODCount);
+	InstaResults.SetNum(LODCount);
+	OptimizeLogs.SetNum(LODCount);
+
+	for (int32 LODIndex=0; LODIndex<LODCount; LODIndex++)
+	{
+		OutMeshes[LODIndex] = AllocInstaLODMesh();
+	}
+
+	const double T0 = FPlatformTime::Seconds();
+
+	// NOTE: every LOD is optimized by the operation of its own execution context into its own output mesh, the input mesh is only read
+	ParallelFor(LODCount, [&](const int32 LODIndex)
+	{
+		FInstaLODScopedExecutionContext Context(*ExecutionContexts);
+		InstaResults[LODIndex] = OptimizeWithResultCache(*Context, InstaMesh, OutMeshes[LODIndex], OptimizeSettings[LODIndex]);
+
+		if (!InstaResults[LODIndex].Success)
+		{
+			OptimizeLogs[LODIndex] = Context->GetCapturedLog();
+		}
+	}, CVarParallelLODs.GetValueOnAnyThread() == 0);
+
+	UE_LOG(LogInstaLOD, Verbose, TEXT("Reduced %d LODs in %.3fs."), LODCount, (float)(FPlatformTime::Seconds() - T0));
+
+	// NOTE: results are finalized serially as notifications must be dispatched from the game thread
+	// and failed LODs fall back to the shared input mesh
+	bool bSuccess = true;
+	for (int32 LODIndex=0; LODIndex<LODCount; LODIndex++)
+	{
+		InstaLOD::OptimizeResult& InstaResult = InstaResults[LODIndex];
+		FinalizeReducedMesh(InstaResult.Success ? OutMeshes[LODIndex] : InstaMesh, InstaResult, OptimizeLogs[LODIndex], OutMaterialMap, OutReducedMeshes[LODIndex], OutMaxDeviations[LODIndex]);
+		bSuccess &= InstaResult.Success;
+
+		DeallocInstaLODMesh(OutMeshes[LODIndex]);
+	}
 
-	InstaLOD->DeallocMesh(InstaMesh);
-	InstaLOD->DeallocMesh(OutMesh);
+	DeallocInstaLODMesh(InstaMesh);
+	return bSuccess;
 }
  
 bool FInstaLOD::ReduceSkeletalMesh(class USkeletalMesh* SkeletalMesh, int32 LODIndex)
@@ -1726,6 +2280,7 @@ bool FInstaLOD::ReduceSkeletalMesh(class USkeletalMesh* SkeletalMesh, int32 LODI
 void FInstaLOD::ReduceSkeletalMeshAtLODIndex(class USkeletalMesh* SkeletalMesh, int32 LODIndex,
 	const FSkeletalMeshOptimizationSettings& Settings, bool bCalcLODDistance, const class ITargetPlatform* TargetPlatform)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLOD::ReduceSkeletalMeshAtLODIndex);
 	// NOTE: This code is based on Unreal Engine internal skeletalmesh optimization routine
 	// only reduction code is replaced with InstaLOD code.
 
@@ -1997,7 +2552,28 @@ void FInstaLOD::ReduceSkeletalMeshAtLODIndex(class USkeletalMesh* SkeletalMesh,
 
 		// generate optimized insta mesh
 		const InstaLOD::OptimizeSettings OptimizeSettings = UEInstaLODSkeletalMeshHelper::ConvertMeshReductionSettingsToInstaLOD(Settings, SkeletalMesh);
-		InstaLOD::OptimizeResult InstaResult = InstaLOD->Optimize(InstaInputMesh, InstaOutputMesh, OptimizeSettings);
+		{
+			FInstaLODCapture Capture(CVarCapture.GetValueOnAnyThread(), FInstaLODCapture::EOperation::SkeletalOptimize);
+			Capture.AddMesh(InstaInputMesh);
+			Capture.SetOptimizeSettings(OptimizeSettings);
+		}
+
+		FInstaLODScopedExecutionContext Context(*ExecutionContexts);
+		InstaLOD::OptimizeResult InstaResult;
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(InstaLOD::Optimize);
+			FInstaLODScopedStatsSample StatsSample(EInstaLODStatsOperation::SkeletalReduce);
+			InstaResult = Context->GetOptimizeOperation()->Execute(InstaInputMesh, InstaOutputMesh, OptimizeSettings);
+			StatsSample.SetMeshes(InstaInputMesh, InstaResult.Success ? InstaOutputMesh : nullptr);
+			StatsSample.Sample.bSuccess = InstaResult.Success;
+			StatsSample.Sample.MessageCount = Context->GetCapturedMessageCount();
+		}
+
+		InstaLOD::uint64 WedgeCount = 0u;
+		InstaInputMesh->GetWedgeIndices(&WedgeCount);
+		TRACE_COUNTER_SET(InstaLODTrianglesIn, (int64)(WedgeCount / 3u));
+		InstaOutputMesh->GetWedgeIndices(&WedgeCount);
+		TRACE_COUNTER_SET(InstaLODTrianglesOut, InstaResult.Success ? (int64)(WedgeCount / 3u) : 0);
 
 		if (CVarAssertOnKeyMesh.GetValueOnAnyThread() != 0)
 		{
@@ -2077,8 +2653,8 @@ void FInstaLOD::ReduceSkeletalMeshAtLODIndex(class USkeletalMesh* SkeletalMesh,
 				UE_LOG(LogInstaLOD, Log, TEXT("%s"), *NotificationText.ToString());
 			}
 
-			InstaLOD->DeallocMesh(InstaInputMesh);
-			InstaLOD->DeallocMesh(InstaOutputMesh);
+			DeallocInstaLODMesh(InstaInputMesh);
+			DeallocInstaLODMesh(InstaOutputMesh);
 
 			FSkeletalMeshLODInfo* ReducedLODInfoPtr = SkeletalMesh->GetLODInfo(LODIndex);
 			check(ReducedLODInfoPtr);
@@ -2121,6 +2697,13 @@ void FInstaLOD::ReduceSkeletalMeshAtLODIndex(class USkeletalMesh* SkeletalMesh,
 
 			PostProcessReducedSkeletalMesh(SkeletalMesh, *NewModel, InstaResult.MeshDeviation, Settings, FPlatformTime::Seconds() - T0);
 		}
+		else
+		{
+			UE_LOG(LogInstaLOD, Error, TEXT("Optimization failed. Log: %s"), *Context->GetCapturedLog());
+
+			DeallocInstaLODMesh(InstaInputMesh);
+			DeallocInstaLODMesh(InstaOutputMesh);
+		}
 	}
 
 	if (!bMeshIsReduced)
@@ -2215,97 +2798,179 @@ class UEInstaLODMaterialHelper
 public:
 	static void CopyColorArrayAny(TArray<FColor>& PixelData, InstaLOD::IInstaLODTexturePage* InstaLODTexturePage)
 	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UEInstaLODMaterialHelper::CopyColorArrayAny);
 		check(InstaLODTexturePage);
 		
-		// NOTE: try to use the fast path if possible
-		if (InstaLODTexturePage->GetComponentType() == InstaLOD::IInstaLODTexturePage::ComponentTypeUInt8 &&
-			InstaLODTexturePage->GetPixelType() == InstaLOD::IInstaLODTexturePage::PixelTypeRGBA)
+		// NOTE: texture data always needs to be 8bpp RGBA, the page data is converted in bulk according to its layout
+		if (!FInstaLODTexturePageConversion::ConvertToColor(InstaLODTexturePage, PixelData, /*bFlipY*/true))
 		{
-			CopyColorArray8(PixelData, InstaLODTexturePage->GetData(nullptr), InstaLODTexturePage->GetWidth(), InstaLODTexturePage->GetHeight());
-			return;
+			UE_LOG(LogInstaLOD, Warning, TEXT("Unsupported InstaLOD texture page layout, the page is not converted."));
+			PixelData.Reset();
 		}
-		
-		// NOTE: texture data always needs to be 8bpp RGBA
-		const uint32 Width = InstaLODTexturePage->GetWidth();
-		const uint32 Height = InstaLODTexturePage->GetHeight();
-		
-		PixelData.SetNumUninitialized(InstaLODTexturePage->GetWidth() * InstaLODTexturePage->GetHeight());
-		
-		FColor *OutData = PixelData.GetData();
-		
-		for (uint32 Y=0; Y<Height; Y++)
+	}
+	
+	/** The amount of texels processed by a single task when copying texture pages in parallel. */
+	static constexpr int32 kTexelChunkSize = 64 * 1024;
+	
+	/**
+	 * Invokes the row kernel for every row of a page, blocks of rows are processed in parallel.
+	 * The kernel receives the destination row and the vertically flipped source row.
+	 * NOTE: UE pages start at the top-left while InstaLOD pages start at the bottom-left.
+	 */
+	template<typename RowKernelType>
+	static void ParallelForFlippedRows(const uint32 Width, const uint32 Height, const RowKernelType& RowKernel)
+	{
+		const int32 RowsPerBlock = FMath::Max(1, kTexelChunkSize / (int32)FMath::Max(Width, 1u));
+		ParallelFor(FMath::DivideAndRoundUp((int32)Height, RowsPerBlock), [&](const int32 BlockIndex)
 		{
-			for(uint32 X=0; X<Width; X++)
+			const uint32 FirstRow = (uint32)(BlockIndex * RowsPerBlock);
+			const uint32 EndRow = FMath::Min(FirstRow + (uint32)RowsPerBlock, Height);
+			
+			for (uint32 Y=FirstRow; Y<EndRow; Y++)
 			{
-				const InstaLOD::InstaColorRGBAF32 Color = InstaLODTexturePage->SampleFloat(X, Height - (Y+1u));
-				*OutData++ = FLinearColor(Color.R, Color.G, Color.B, Color.A).ToFColor(false);
+				RowKernel(Y, Height - (Y+1u));
 			}
-		}
+		}, UEInstaLODMeshHelper::IsParallelConversionDisabled());
+	}
+	
+	/**
+	 * Swaps the R and B channels of a row of 8-bit texels, this converts InstaColorRGBA8 to FColor and vice versa.
+	 * The green channel is xor'ed with the green mask and the alpha channel is replaced by the red channel of the output if requested.
+	 * NOTE: texels are processed as packed little endian integers, the loop is branch-free so that it is vectorized by the compiler.
+	 */
+	static FORCEINLINE void SwizzleRowRGBA8(uint32* RESTRICT OutRow, const uint32* RESTRICT InRow, const uint32 Width, const uint32 GreenMask = 0u, const bool bAlphaFromRed = false)
+	{
+		static_assert(PLATFORM_LITTLE_ENDIAN, "The texel swizzle requires a little endian platform.");
+		static_assert(sizeof(FColor) == sizeof(uint32) && sizeof(InstaLOD::InstaColorRGBA8) == sizeof(uint32), "Unexpected texel size.");
+		const uint32 AlphaKeepMask = bAlphaFromRed ? 0x00FFFFFFu : 0xFFFFFFFFu;
 		
+		for (uint32 X=0; X<Width; X++)
+		{
+			const uint32 Texel = InRow[X];
+			const uint32 Swizzled = ((Texel & 0xFF00FF00u) | ((Texel >> 16) & 0xFFu) | ((Texel & 0xFFu) << 16)) ^ (GreenMask << 8);
+			OutRow[X] = (Swizzled & AlphaKeepMask) | (((Swizzled & 0xFFu) << 24) & ~AlphaKeepMask);
+		}
+	}
+	
+	/**
+	 * Narrows a row of 16-bit RGB texels to FColor.
+	 * NOTE: (Value * 0xFF01) >> 24 is identical to Value * 255 / 65535 for all 16-bit values, but doesn't require a division.
+	 */
+	static FORCEINLINE void NarrowRowRGB16(FColor* RESTRICT OutRow, const InstaLOD::InstaColorRGB16* RESTRICT InRow, const uint32 Width)
+	{
+		for (uint32 X=0; X<Width; X++)
+		{
+			const InstaLOD::InstaColorRGB16 Texel = InRow[X];
+			OutRow[X] = FColor((uint8)(((uint32)Texel.R * 0xFF01u) >> 24), (uint8)(((uint32)Texel.G * 0xFF01u) >> 24), (uint8)(((uint32)Texel.B * 0xFF01u) >> 24), 255u);
+		}
 	}
 	
 	static void CopyColorArray16(TArray<FColor>& OutData, const InstaLOD::uint8* InstaLODTexturePageData, const uint32 Width, const uint32 Height)
 	{ 
-		const uint32 NumElems = Width * Height;
+		TRACE_CPUPROFILER_EVENT_SCOPE(UEInstaLODMaterialHelper::CopyColorArray16);
 		const InstaLOD::InstaColorRGB16* const InData = (InstaLOD::InstaColorRGB16*)InstaLODTexturePageData;
-		OutData.SetNumUninitialized(NumElems);
-
-		for (uint32 Y = 0; Y < Height; Y++)
+		OutData.SetNumUninitialized(Width * Height);
+		FColor *const OutTexels = OutData.GetData();
+		
+		ParallelForFlippedRows(Width, Height, [&](const uint32 Y, const uint32 FlippedY)
 		{
-			for (uint32 X = 0; X < Width; X++)
-			{
-				const uint32 Index = X + Y * Width;
-				const uint32 IndexFlippedY = X + Width * (Width - (Y + 1u));
-
-				OutData[Index].R = FMath::Clamp((uint32)InData[IndexFlippedY].R * 255u / 65535u, 0u, 255u);
-				OutData[Index].G = FMath::Clamp((uint32)InData[IndexFlippedY].G * 255u / 65535u, 0u, 255u);
-				OutData[Index].B = FMath::Clamp((uint32)InData[IndexFlippedY].B * 255u / 65535u, 0u, 255u);
-				OutData[Index].A = 255;
-			}
-		}
+			NarrowRowRGB16(OutTexels + (SIZE_T)Y * Width, InData + (SIZE_T)FlippedY * Width, Width);
+		});
 	}
 	
 	static void CopyColorArray8(TArray<FColor>& OutData, const InstaLOD::uint8* InstaLODTexturePageData, const uint32 Width, const uint32 Height)
 	{
-		const uint32 NumElems = Width * Height;
-		const InstaLOD::InstaColorRGBA8 *InData = (InstaLOD::InstaColorRGBA8*)InstaLODTexturePageData;
-		OutData.SetNumUninitialized(NumElems);
+		TRACE_CPUPROFILER_EVENT_SCOPE(UEInstaLODMaterialHelper::CopyColorArray8);
+		const uint32 *const InData = (const uint32*)InstaLODTexturePageData;
+		OutData.SetNumUninitialized(Width * Height);
+		uint32 *const OutTexels = (uint32*)OutData.GetData();
 		
-		for (uint32 Y=0; Y<Height; Y++)
+		ParallelForFlippedRows(Width, Height, [&](const uint32 Y, const uint32 FlippedY)
 		{
-			for (uint32 X=0; X<Width; X++)
-			{
-				const uint32 Index = X + Y * Width;
-				const uint32 IndexFlippedY = X + Width * (Width - (Y+1u));
-
-				OutData[Index].R = InData[IndexFlippedY].R;
-				OutData[Index].G = InData[IndexFlippedY].G;
-				OutData[Index].B = InData[IndexFlippedY].B;
-				OutData[Index].A = InData[IndexFlippedY].A;
-			}
-		}
+			SwizzleRowRGBA8(OutTexels + (SIZE_T)Y * Width, InData + (SIZE_T)FlippedY * Width, Width);
+		});
 	}
 	
-	static void CopyColorArray(InstaLOD::uint8* OutInstaLODTexturePageData, const TArray<FColor>& InData, const uint32 Width, const uint32 Height)
+	/** Specifies the fixups applied while a flattened material page is copied to an InstaLOD texture page. */
+	enum class EPageTransfer : uint8
+	{
+		Color,
+		Opacity,	/**< The alpha channel is set to the red channel. */
+		NormalMap	/**< The green channel is inverted to convert the normal map to OpenGL tangent space. */
+	};
+	
+	/** Copies UE pixel data to an InstaLOD texture page, the rows are flipped and the page fixups applied in a single pass. */
+	static void CopyColorArray(InstaLOD::uint8* OutInstaLODTexturePageData, const TArray<FColor>& InData, const uint32 Width, const uint32 Height,
+							   const EPageTransfer Transfer = EPageTransfer::Color)
 	{
-		const size_t NumElems = InData.Num();
+		TRACE_CPUPROFILER_EVENT_SCOPE(UEInstaLODMaterialHelper::CopyColorArray);
+		check((uint64)InData.Num() == (uint64)Width * Height);
 		// NOTE: UE texture pages are always uint8, RGBA
-		InstaLOD::InstaColorRGBA8* const OutData = (InstaLOD::InstaColorRGBA8*) OutInstaLODTexturePageData;
-
-		for (uint32 Y = 0; Y < Height; Y++)
+		uint32 *const OutData = (uint32*)OutInstaLODTexturePageData;
+		const uint32 *const InTexels = (const uint32*)InData.GetData();
+		const uint32 GreenMask = Transfer == EPageTransfer::NormalMap ? 0xFFu : 0u;
+		const bool bAlphaFromRed = Transfer == EPageTransfer::Opacity;
+		
+		ParallelForFlippedRows(Width, Height, [&](const uint32 Y, const uint32 FlippedY)
+		{
+			SwizzleRowRGBA8(OutData + (SIZE_T)Y * Width, InTexels + (SIZE_T)FlippedY * Width, Width, GreenMask, bAlphaFromRed);
+		});
+	}
+	
+	/**
+	 * Texture pages that have been transferred to the materials of a material data instance.
+	 * Identical pages of subsequent materials are added through a shared handle instead of copying their pixels again.
+	 */
+	class FSharedTexturePages
+	{
+	public:
+		/** Adds the page to the material through a shared handle if an identical page has been transferred before. */
+		InstaLOD::IInstaLODTexturePage* AddSharedTexturePage(const TArray<FColor>& InData, const FIntPoint& InSize, const char* const InName,
+															 InstaLOD::IInstaLODMaterial *const OutInstaMaterial, uint64& OutDataHash) const
 		{
-			for (uint32 X = 0; X < Width; X++)
+			OutDataHash = FXxHash64::HashBuffer(InData.GetData(), InData.Num() * sizeof(FColor)).Hash;
+			
+			TArray<const FEntry*, TInlineAllocator<4>> Candidates;
+			Entries.MultiFindPointer(OutDataHash, Candidates);
+			
+			for (const FEntry *const Candidate : Candidates)
 			{
-				const uint32 Index = X + Y * Width;
-				const uint32 IndexFlippedY = X + Width * (Width - (Y + 1u));
-
-				OutData[Index].R = InData[IndexFlippedY].R;
-				OutData[Index].G = InData[IndexFlippedY].G;
-				OutData[Index].B = InData[IndexFlippedY].B;
-				OutData[Index].A = InData[IndexFlippedY].A;
+				// NOTE: page names are compared by pointer, as the page names are constants
+				if (Candidate->Name != InName || Candidate->Size != InSize ||
+					FMemory::Memcmp(Candidate->Data->GetData(), InData.GetData(), InData.Num() * sizeof(FColor)) != 0)
+					continue;
+				
+				InstaLOD::IInstaLODTexturePage::SharedHandle *const Handle = Candidate->Material->AllocTexturePageSharedHandle(InName);
+				
+				if (Handle == nullptr)
+					return nullptr;
+				
+				InstaLOD::IInstaLODTexturePage *const TexturePage = OutInstaMaterial->AddTexturePage(Handle);
+				Candidate->Material->DeallocTexturePageSharedHandle(Handle);
+				return TexturePage;
 			}
+			return nullptr;
 		}
-	}
+		
+		/** Registers a page that has been copied to the material. NOTE: the page data must outlive this instance. */
+		void Add(const TArray<FColor>& InData, const FIntPoint& InSize, const char* const InName, InstaLOD::IInstaLODMaterial *const InstaMaterial, const uint64 DataHash)
+		{
+			Entries.Add(DataHash, FEntry{ &InData, InSize, InName, InstaMaterial });
+		}
+		
+		int32 SharedPageCount = 0;
+		
+	private:
+		struct FEntry
+		{
+			const TArray<FColor>* Data;
+			FIntPoint Size;
+			const char* Name;
+			InstaLOD::IInstaLODMaterial* Material;
+		};
+		
+		TMultiMap<uint64, FEntry> Entries;
+	};
 	
 	static void SetColorArrayToConstant(TArray<FColor>& OutData, const FColor& Value)
 	{
@@ -2322,8 +2987,36 @@ public:
 #	define SetFFlattenMaterialPageSize(MATERIAL, PAGENAME, VALUE) (MATERIAL).SetPropertySize( EFlattenMaterialProperties :: PAGENAME, (VALUE))
 #	define GetFFlattenMaterialPageData(MATERIAL, PAGENAME) (MATERIAL).GetPropertySamples( EFlattenMaterialProperties :: PAGENAME)
 		
+	/**
+	 * Collapses all pages of the material whose texels are constant within the tolerance to a single texel.
+	 *
+	 * @return the amount of collapsed pages.
+	 */
+	static int32 CollapseConstantPages(FFlattenMaterial& Material, const int32 Tolerance)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UEInstaLODMaterialHelper::CollapseConstantPages);
+		int32 CollapsedPageCount = 0;
+		
+		for (int32 PropertyIndex=0; PropertyIndex<(int32)EFlattenMaterialProperties::NumFlattenMaterialProperties; PropertyIndex++)
+		{
+			const EFlattenMaterialProperties Property = (EFlattenMaterialProperties)PropertyIndex;
+			TArray<FColor>& Samples = Material.GetPropertySamples(Property);
+			FColor Value;
+			
+			if (Samples.Num() <= 1 || !FInstaLODTexturePageConversion::FindConstantValue(Samples, Tolerance, Value))
+				continue;
+			
+			Samples.SetNum(1);
+			Samples[0] = Value;
+			Material.SetPropertySize(Property, FIntPoint(1, 1));
+			CollapsedPageCount++;
+		}
+		return CollapsedPageCount;
+	}
+	
 	static void ConvertInstaLODMaterialToFlattenMaterial(InstaLOD::IInstaLODMaterial *const InstaMaterial, FFlattenMaterial &OutMaterial, const IInstaLOD::UE_MaterialProxySettings& settings)
 	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UEInstaLODMaterialHelper::ConvertInstaLODMaterialToFlattenMaterial);
 		uint32 PageWidth, PageHeight;
 		OutMaterial = FMaterialUtilities::CreateFlattenMaterialWithSettings(settings);
 		FColor DefaultColor(255, 255, 255, 255);
@@ -2476,7 +3169,8 @@ public:
 	}
 	
 	static void ConvertFlattenMaterialPageToInstaTexturePage(const TArray<FColor>& InData, const FIntPoint& InSize, const char* const InName,
-															  InstaLOD::IInstaLODMaterialData *const MaterialData, InstaLOD::IInstaLODMaterial *const OutInstaMaterial)
+															  InstaLOD::IInstaLODMaterialData *const MaterialData, InstaLOD::IInstaLODMaterial *const OutInstaMaterial,
+															  FSharedTexturePages& SharedPages)
 	{
 		// do not create empty pages
 		if (InData.Num() == 0)
@@ -2502,63 +3196,58 @@ public:
 		else if (InName == kInstaLODPageNameEmissive)
 			TexturePageType = InstaLOD::IInstaLODTexturePage::TypeEmissive;
 		
-		InstaLOD::IInstaLODTexturePage *const TexturePage = OutInstaMaterial->AddTexturePage(InName, TexturePageType, ComponentType, PixelType);
-		TexturePage->Reallocate(InSize.X, InSize.Y);
-		CopyColorArray(TexturePage->GetData(nullptr), InData, InSize.X, InSize.Y);
+		// NOTE: flattened materials of a cluster often share identical pages, these pages are shared instead of copied
+		uint64 DataHash = 0u;
+		InstaLOD::IInstaLODTexturePage *TexturePage = SharedPages.AddSharedTexturePage(InData, InSize, InName, OutInstaMaterial, DataHash);
 		
-		if (TexturePageType == InstaLOD::IInstaLODTexturePage::TypeOpacity)
+		if (TexturePage != nullptr)
 		{
-			// ensure alpha values are setup
-			const uint32 ElementCount = InSize.X * InSize.Y;
-			
-			InstaLOD::InstaColorRGBA8* OutData = (InstaLOD::InstaColorRGBA8*)TexturePage->GetData(nullptr);
-			for (uint32 ElementIndex=0u; ElementIndex<ElementCount; ElementIndex++)
-			{
-				OutData->A = OutData->R;
-				OutData++;
-			}
+			SharedPages.SharedPageCount++;
+		}
+		else
+		{
+			const EPageTransfer Transfer = TexturePageType == InstaLOD::IInstaLODTexturePage::TypeOpacity ? EPageTransfer::Opacity :
+										   TexturePageType == InstaLOD::IInstaLODTexturePage::TypeNormalMapTangentSpace ? EPageTransfer::NormalMap : EPageTransfer::Color;
 			
-			OutInstaMaterial->SetUseTexturePageAsAlphaMask(TexturePage);
+			TexturePage = OutInstaMaterial->AddTexturePage(InName, TexturePageType, ComponentType, PixelType);
+			TexturePage->Reallocate(InSize.X, InSize.Y);
+			CopyColorArray(TexturePage->GetData(nullptr), InData, InSize.X, InSize.Y, Transfer);
+			SharedPages.Add(InData, InSize, InName, OutInstaMaterial, DataHash);
 		}
-		else if (TexturePageType == InstaLOD::IInstaLODTexturePage::TypeNormalMapTangentSpace)
+		
+		if (TexturePageType == InstaLOD::IInstaLODTexturePage::TypeOpacity)
 		{
-			// Ensure OpenGL tangent space map
-			const uint32 ElementCount = InSize.X * InSize.Y;
-
-			InstaLOD::InstaColorRGBA8* OutData = (InstaLOD::InstaColorRGBA8*)TexturePage->GetData(nullptr);
-
-			for (uint32 ElementIndex=0u; ElementIndex<ElementCount; ElementIndex++)
-			{
-				OutData->G = 1.0f - OutData->G;
-				OutData++;
-			}
+			OutInstaMaterial->SetUseTexturePageAsAlphaMask(TexturePage);
 		}
 		
 		// enable writing of all texture page matching the specified name and it's exact specification
 		MaterialData->EnableOutputForTexturePage(InName, TexturePageType, ComponentType, PixelType);
 	}
 	
-	static void ConvertFlattenMaterialToInstaMaterial(const FFlattenMaterial& InMaterial, InstaLOD::IInstaLODMaterialData *const MaterialData, InstaLOD::IInstaLODMaterial *const OutInstaMaterial)
+	static void ConvertFlattenMaterialToInstaMaterial(const FFlattenMaterial& InMaterial, InstaLOD::IInstaLODMaterialData *const MaterialData, InstaLOD::IInstaLODMaterial *const OutInstaMaterial,
+												  FSharedTexturePages& SharedPages)
 	{
-		ConvertFlattenMaterialPageToInstaTexturePage(GetFFlattenMaterialPageData(InMaterial, Diffuse), GetFFlattenMaterialPageSize(InMaterial, Diffuse), kInstaLODPageNameDiffuse, MaterialData, OutInstaMaterial);
-		ConvertFlattenMaterialPageToInstaTexturePage(GetFFlattenMaterialPageData(InMaterial, Normal), GetFFlattenMaterialPageSize(InMaterial, Normal), kInstaLODPageNameNormal, MaterialData, OutInstaMaterial);
-		ConvertFlattenMaterialPageToInstaTexturePage(GetFFlattenMaterialPageData(InMaterial, Roughness), GetFFlattenMaterialPageSize(InMaterial, Roughness), kInstaLODPageNameRoughness, MaterialData, OutInstaMaterial);
-		ConvertFlattenMaterialPageToInstaTexturePage(GetFFlattenMaterialPageData(InMaterial, Metallic), GetFFlattenMaterialPageSize(InMaterial, Metallic), kInstaLODPageNameMetallic, MaterialData, OutInstaMaterial);
-		ConvertFlattenMaterialPageToInstaTexturePage(GetFFlattenMaterialPageData(InMaterial, Specular), GetFFlattenMaterialPageSize(InMaterial, Specular), kInstaLODPageNameSpecular, MaterialData, OutInstaMaterial);
+		TRACE_CPUPROFILER_EVENT_SCOPE(UEInstaLODMaterialHelper::ConvertFlattenMaterialToInstaMaterial);
+		ConvertFlattenMaterialPageToInstaTexturePage(GetFFlattenMaterialPageData(InMaterial, Diffuse), GetFFlattenMaterialPageSize(InMaterial, Diffuse), kInstaLODPageNameDiffuse, MaterialData, OutInstaMaterial, SharedPages);
+		ConvertFlattenMaterialPageToInstaTexturePage(GetFFlattenMaterialPageData(InMaterial, Normal), GetFFlattenMaterialPageSize(InMaterial, Normal), kInstaLODPageNameNormal, MaterialData, OutInstaMaterial, SharedPages);
+		ConvertFlattenMaterialPageToInstaTexturePage(GetFFlattenMaterialPageData(InMaterial, Roughness), GetFFlattenMaterialPageSize(InMaterial, Roughness), kInstaLODPageNameRoughness, MaterialData, OutInstaMaterial, SharedPages);
+		ConvertFlattenMaterialPageToInstaTexturePage(GetFFlattenMaterialPageData(InMaterial, Metallic), GetFFlattenMaterialPageSize(InMaterial, Metallic), kInstaLODPageNameMetallic, MaterialData, OutInstaMaterial, SharedPages);
+		ConvertFlattenMaterialPageToInstaTexturePage(GetFFlattenMaterialPageData(InMaterial, Specular), GetFFlattenMaterialPageSize(InMaterial, Specular), kInstaLODPageNameSpecular, MaterialData, OutInstaMaterial, SharedPages);
 
-		ConvertFlattenMaterialPageToInstaTexturePage(GetFFlattenMaterialPageData(InMaterial, Emissive), GetFFlattenMaterialPageSize(InMaterial, Emissive), kInstaLODPageNameEmissive, MaterialData, OutInstaMaterial);
-		ConvertFlattenMaterialPageToInstaTexturePage(GetFFlattenMaterialPageData(InMaterial, Opacity), GetFFlattenMaterialPageSize(InMaterial, Opacity), kInstaLODPageNameOpacity, MaterialData, OutInstaMaterial);
-		ConvertFlattenMaterialPageToInstaTexturePage(GetFFlattenMaterialPageData(InMaterial, SubSurface), GetFFlattenMaterialPageSize(InMaterial, SubSurface), kInstaLODPageNameSubSurface, MaterialData, OutInstaMaterial);
+		ConvertFlattenMaterialPageToInstaTexturePage(GetFFlattenMaterialPageData(InMaterial, Emissive), GetFFlattenMaterialPageSize(InMaterial, Emissive), kInstaLODPageNameEmissive, MaterialData, OutInstaMaterial, SharedPages);
+		ConvertFlattenMaterialPageToInstaTexturePage(GetFFlattenMaterialPageData(InMaterial, Opacity), GetFFlattenMaterialPageSize(InMaterial, Opacity), kInstaLODPageNameOpacity, MaterialData, OutInstaMaterial, SharedPages);
+		ConvertFlattenMaterialPageToInstaTexturePage(GetFFlattenMaterialPageData(InMaterial, SubSurface), GetFFlattenMaterialPageSize(InMaterial, SubSurface), kInstaLODPageNameSubSurface, MaterialData, OutInstaMaterial, SharedPages);
 
-		ConvertFlattenMaterialPageToInstaTexturePage(GetFFlattenMaterialPageData(InMaterial, OpacityMask), GetFFlattenMaterialPageSize(InMaterial, OpacityMask), kInstaLODPageNameOpacityMask, MaterialData, OutInstaMaterial);
-		ConvertFlattenMaterialPageToInstaTexturePage(GetFFlattenMaterialPageData(InMaterial, AmbientOcclusion), GetFFlattenMaterialPageSize(InMaterial, AmbientOcclusion), kInstaLODPageNameAmbientOcclusion, MaterialData, OutInstaMaterial);
+		ConvertFlattenMaterialPageToInstaTexturePage(GetFFlattenMaterialPageData(InMaterial, OpacityMask), GetFFlattenMaterialPageSize(InMaterial, OpacityMask), kInstaLODPageNameOpacityMask, MaterialData, OutInstaMaterial, SharedPages);
+		ConvertFlattenMaterialPageToInstaTexturePage(GetFFlattenMaterialPageData(InMaterial, AmbientOcclusion), GetFFlattenMaterialPageSize(InMaterial, AmbientOcclusion), kInstaLODPageNameAmbientOcclusion, MaterialData, OutInstaMaterial, SharedPages);
 	}
 };
 
 struct UEProxyWrapper
 {
-	UEProxyWrapper(InstaLOD::IInstaLOD* InInstaLOD, const bool InIsMergeOperation) :
+	UEProxyWrapper(InstaLOD::IInstaLOD* InInstaLOD, FInstaLODExecutionContext& InContext, const bool InIsMergeOperation) :
 	InstaLOD(InInstaLOD),
+	Context(&InContext),
 	InstaMaterial(nullptr),
 	MergeOperation(nullptr),
 	RemeshOperation(nullptr)
@@ -2627,8 +3316,9 @@ struct UEProxyWrapper
 		}
 	}
 	
-	bool Execute(InstaLOD::IInstaLODMesh *OutputMesh, const struct FMeshProxySettings& InProxySettings)
+	bool Execute(InstaLOD::IInstaLODMesh *OutputMesh, const struct FMeshProxySettings& InProxySettings, FInstaLODCapture *const Capture = nullptr)
 	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UEProxyWrapper::Execute);
 		check(InstaLOD);
 		
 		InstaMaterial = nullptr;
@@ -2643,6 +3333,16 @@ struct UEProxyWrapper
 			MeshMergeSettings.StackDuplicateShells = true;
 			MeshMergeSettings.Deterministic = CVarProxyDeterministic.GetValueOnAnyThread() > 0 ? true : false;
 
+			if (Capture != nullptr)
+			{
+				Capture->SetMeshMergeSettings(MeshMergeSettings);
+
+				if (CVarHLODScreenSizeFactor.GetValueOnAnyThread() > 0.0f)
+				{
+					Capture->SetOptimizeSettings(GetMergeOptimizeSettings(InProxySettings));
+				}
+			}
+
 			InstaLOD::MeshMergeResult MergeResult = MergeOperation->Execute(OutputMesh, MeshMergeSettings);
 			
 			if (CVarAssertOnKeyMesh.GetValueOnAnyThread() != 0)
@@ -2659,15 +3359,10 @@ struct UEProxyWrapper
 			// also optimize with InstaLOD
 			if (CVarHLODScreenSizeFactor.GetValueOnAnyThread() > 0.0f)
 			{
-				InstaLOD::OptimizeSettings OptimizeSettings = UEInstaLODMeshHelper::ConvertMeshReductionSettingsToInstaLOD(FMeshReductionSettings());
-				OptimizeSettings.ScreenSizeInPixels = InProxySettings.ScreenSize * CVarHLODScreenSizeFactor.GetValueOnAnyThread();
-				OptimizeSettings.RecalculateNormals = InProxySettings.bRecalculateNormals;
-				OptimizeSettings.HardAngleThreshold = InProxySettings.HardAngleThreshold;
-				OptimizeSettings.Deterministic = CVarProxyDeterministic.GetValueOnAnyThread() > 0 ? true : false;
+				const InstaLOD::OptimizeSettings OptimizeSettings = GetMergeOptimizeSettings(InProxySettings);
 				
-				// NOTE: as we're only optimizing a single mesh, we're using the shortcut API
-				// if you're optimizing multiple objects and need progress information use IInstaLOD::AllocOptimizeOperation
-				InstaLOD::OptimizeResult OptimizeResult = InstaLOD->Optimize(OutputMesh, OutputMesh, OptimizeSettings);
+				// NOTE: the optimize operation of the execution context is used, the shortcut API would bypass the per-worker state
+				InstaLOD::OptimizeResult OptimizeResult = Context->GetOptimizeOperation()->Execute(OutputMesh, OutputMesh, OptimizeSettings);
 
 				if (CVarAssertOnKeyMesh.GetValueOnAnyThread() != 0)
 				{
@@ -2708,6 +3403,11 @@ struct UEProxyWrapper
 			RemeshSettings.BakeOutput.TexturePageNormalObjectSpace = false;
 			RemeshSettings.Deterministic = CVarProxyDeterministic.GetValueOnAnyThread() > 0 ? true : false;
 
+			if (Capture != nullptr)
+			{
+				Capture->SetRemeshingSettings(RemeshSettings);
+			}
+
 			InstaLOD::RemeshingResult RemeshResult = RemeshOperation->Execute(OutputMesh, RemeshSettings);
 
 			if (CVarAssertOnKeyMesh.GetValueOnAnyThread() != 0)
@@ -2725,7 +3425,19 @@ struct UEProxyWrapper
 			return true;
 		}
 	}
+	/** Gets the settings used to optimize the merged proxy mesh. */
+	static InstaLOD::OptimizeSettings GetMergeOptimizeSettings(const struct FMeshProxySettings& InProxySettings)
+	{
+		InstaLOD::OptimizeSettings OptimizeSettings = UEInstaLODMeshHelper::ConvertMeshReductionSettingsToInstaLOD(FMeshReductionSettings());
+		OptimizeSettings.ScreenSizeInPixels = InProxySettings.ScreenSize * CVarHLODScreenSizeFactor.GetValueOnAnyThread();
+		OptimizeSettings.RecalculateNormals = InProxySettings.bRecalculateNormals;
+		OptimizeSettings.HardAngleThreshold = InProxySettings.HardAngleThreshold;
+		OptimizeSettings.Deterministic = CVarProxyDeterministic.GetValueOnAnyThread() > 0 ? true : false;
+		return OptimizeSettings;
+	}
+
 	InstaLOD::IInstaLOD *InstaLOD;
+	FInstaLODExecutionContext *Context;
 	InstaLOD::IInstaLODMaterial* InstaMaterial;
 	InstaLOD::IMeshMergeOperation2 *MergeOperation;
 	InstaLOD::IRemeshingOperation *RemeshOperation;
@@ -2733,7 +3445,13 @@ struct UEProxyWrapper
 
 InstaLOD::IInstaLODMesh* FInstaLOD::AllocInstaLODMesh()
 {
-	return InstaLOD->AllocMesh();
+	return MeshPool->Acquire();
+}
+
+void FInstaLOD::DeallocInstaLODMesh(InstaLOD::IInstaLODMesh* Mesh)
+{
+	const int64 MaxRetainedBytes = (int64)FMath::Max(CVarMeshPoolMaxRetainedMB.GetValueOnAnyThread(), 0) * 1024 * 1024;
+	MeshPool->Release(Mesh, MaxRetainedBytes);
 }
 
 InstaLOD::IInstaLODSkeleton* FInstaLOD::AllocInstaLODSkeleton()
@@ -2748,10 +3466,10 @@ bool FInstaLOD::ConvertInstaLODMeshToRawMesh(InstaLOD::IInstaLODMesh* InMesh, st
 	return true;
 }
 
-bool FInstaLOD::ConvertInstaLODMeshToMeshDescription(InstaLOD::IInstaLODMesh* InMesh, const TMap<int32, FName> &MaterialMapOut, struct FMeshDescription &OutMesh)
+bool FInstaLOD::ConvertInstaLODMeshToMeshDescription(InstaLOD::IInstaLODMesh* InMesh, const TMap<int32, FName> &MaterialMapOut, struct FMeshDescription &OutMesh, const EInstaLODWindingMode WindingMode)
 {
 	check(InMesh);
-	UEInstaLODMeshHelper::InstaLODMeshToMeshDescription(InMesh, MaterialMapOut, OutMesh);
+	UEInstaLODMeshHelper::InstaLODMeshToMeshDescription(InMesh, MaterialMapOut, OutMesh, WindingMode);
 	return true;
 }
  
@@ -2788,6 +3506,7 @@ bool FInstaLOD::ConvertInstaLODMeshToSkeletalLODModel(InstaLOD::IInstaLODMesh *c
 
 bool FInstaLOD::ConvertFlattenMaterialsToInstaLODMaterialData(const TArray<FFlattenMaterial>& InputMaterials, InstaLOD::IInstaLODMaterialData* MaterialData, const IInstaLOD::UE_MaterialProxySettings& MaterialSettings)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLOD::ConvertFlattenMaterialsToInstaLODMaterialData);
 	check(MaterialData);
 	
 	// setup default size
@@ -2850,13 +3569,16 @@ bool FInstaLOD::ConvertFlattenMaterialsToInstaLODMaterialData(const TArray<FFlat
 	}
 	
 	// NOTE: it's important that material IDs match those specified in the meshes
+	UEInstaLODMaterialHelper::FSharedTexturePages SharedPages;
 	for (int32 MaterialIndex=0; MaterialIndex<InputMaterials.Num(); MaterialIndex++)
 	{
 		FString MaterialName = FString::Printf(TEXT("INSTALOD_TEMP_MATERIAL_%i"), MaterialIndex);
 		InstaLOD::IInstaLODMaterial *const InstaMaterial = MaterialData->AddMaterialWithID(TCHAR_TO_ANSI(*MaterialName), MaterialIndex);
-		UEInstaLODMaterialHelper::ConvertFlattenMaterialToInstaMaterial(InputMaterials[MaterialIndex], MaterialData, InstaMaterial);
+		UEInstaLODMaterialHelper::ConvertFlattenMaterialToInstaMaterial(InputMaterials[MaterialIndex], MaterialData, InstaMaterial, SharedPages);
 	}
 	
+	UE_LOG(LogInstaLOD, Verbose, TEXT("Converted %d flattened materials, %d texture pages were shared."), InputMaterials.Num(), SharedPages.SharedPageCount);
+	
 	return true;
 }
 
@@ -2878,6 +3600,7 @@ void FInstaLOD::ProxyLOD(
 	const TArray<struct FFlattenMaterial>& InputMaterials, 
 	const FGuid InJobGUID)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLOD::ProxyLOD);
 	UE_LOG(LogInstaLOD, Log, TEXT("Building Proxy"));
 	
 	if (IsRunningCommandlet() && !InstaLOD->IsHostAuthorized())
@@ -2885,9 +3608,93 @@ void FInstaLOD::ProxyLOD(
 		UE_LOG(LogInstaLOD, Fatal, TEXT("This machine is not authorized to run InstaLOD. Please authorize this machine before cooking using the editor or InstaLOD Pipeline."));
 	}
 	
+	// NOTE: commandlets block the game thread while waiting for the proxy, therefore commandlets always build proxies synchronously
+	if (CVarHLODAsync.GetValueOnAnyThread() == 0 || IsRunningCommandlet())
+	{
+		FMeshDescription OutProxyMesh;
+		FFlattenMaterial OutMaterial;
+		BuildProxy(InData, InProxySettings, InputMaterials, OutProxyMesh, OutMaterial);
+		
+		CompleteDelegate.ExecuteIfBound(OutProxyMesh, OutMaterial, InJobGUID);
+		return;
+	}
+	
+	// NOTE: the caller releases the merge data once ProxyLOD returns, therefore the job owns copies of all inputs
+	struct FAsyncProxyJob
+	{
+		TArray<FMeshDescription> MeshDescriptions;
+		TArray<FMeshMergeData> Data;
+		FMeshProxySettings ProxySettings;
+		TArray<FFlattenMaterial> InputMaterials;
+		FProxyCompleteDelegate CompleteDelegate;
+		FGuid JobGUID;
+		FMeshDescription OutProxyMesh;
+		FFlattenMaterial OutMaterial;
+	};
+	
+	const TSharedRef<FAsyncProxyJob, ESPMode::ThreadSafe> Job = MakeShared<FAsyncProxyJob, ESPMode::ThreadSafe>();
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLOD::ProxyLOD::CopyInputs);
+		Job->MeshDescriptions.Reserve(InData.Num());
+		Job->Data = InData;
+		
+		for (FMeshMergeData& Data : Job->Data)
+		{
+			// NOTE: the mesh descriptions are reserved up front, so that the pointers remain valid
+			Data.RawMesh = &Job->MeshDescriptions.Add_GetRef(*Data.RawMesh);
+		}
+		Job->ProxySettings = InProxySettings;
+		Job->InputMaterials = InputMaterials;
+		Job->CompleteDelegate = CompleteDelegate;
+		Job->JobGUID = InJobGUID;
+	}
+	
+	FScopeLock ScopeLock(&PendingProxyBuildsLock);
+	PendingProxyBuilds.RemoveAll([](const TFuture<void>& Future) { return Future.IsReady(); });
+	PendingProxyBuilds.Add(Async(EAsyncExecution::ThreadPool, [this, Job]()
+	{
+		BuildProxy(Job->Data, Job->ProxySettings, Job->InputMaterials, Job->OutProxyMesh, Job->OutMaterial);
+		
+		// NOTE: the delegate was copied when the job was created, the game thread task must not access this instance
+		AsyncTask(ENamedThreads::GameThread, [Job]()
+		{
+			Job->CompleteDelegate.ExecuteIfBound(Job->OutProxyMesh, Job->OutMaterial, Job->JobGUID);
+		});
+	}));
+}
+
+void FInstaLOD::BuildProxy(const TArray<struct FMeshMergeData>& InData, const struct FMeshProxySettings& InProxySettings,
+						   const TArray<struct FFlattenMaterial>& InputMaterials, FMeshDescription& OutProxyMesh, FFlattenMaterial& OutMaterial)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLOD::BuildProxy);
+	
 	const double T0 = FPlatformTime::Seconds();
+	const bool bIsMergeOperation = CVarHLODRemesh.GetValueOnAnyThread() == 0;
+	
+	// NOTE: the cache is keyed by the unconverted inputs, so that cache hits skip the conversion of the merge data
+	const bool bUseProxyCache = CVarHLODCache.GetValueOnAnyThread() != 0;
+	FInstaLODResultCache::FKey ProxyCacheKey;
+	
+	if (bUseProxyCache)
+	{
+		const bool bOptimizesMergedMesh = bIsMergeOperation && CVarHLODScreenSizeFactor.GetValueOnAnyThread() > 0.0f;
+		const InstaLOD::OptimizeSettings MergeOptimizeSettings = UEProxyWrapper::GetMergeOptimizeSettings(InProxySettings);
+		ProxyCacheKey = FInstaLODResultCache::ComputeProxyKey(InstaLOD, InData, InputMaterials, InProxySettings, bIsMergeOperation,
+															  CVarProxyDeterministic.GetValueOnAnyThread() > 0, CVarConstantPageTolerance.GetValueOnAnyThread(),
+															  bOptimizesMergedMesh ? &MergeOptimizeSettings : nullptr);
+		
+		if (FInstaLODResultCache::Get().LoadProxy(ProxyCacheKey, OutProxyMesh, OutMaterial))
+		{
+			UE_LOG(LogInstaLOD, Log, TEXT("Loaded proxy from the LOD cache in %.2fs."), (float)(FPlatformTime::Seconds() - T0));
+			return;
+		}
+	}
 	
-	UEProxyWrapper InstaOperation(InstaLOD, CVarHLODRemesh.GetValueOnAnyThread() == 0);
+	// NOTE: the sample is created after the cache lookup, cache hits are counted by the LOD cache statistics
+	FInstaLODScopedStatsSample StatsSample(EInstaLODStatsOperation::ProxyLOD);
+	FInstaLODScopedExecutionContext Context(*ExecutionContexts);
+	UEProxyWrapper InstaOperation(InstaLOD, *Context, bIsMergeOperation);
+	FInstaLODCapture Capture(CVarCapture.GetValueOnAnyThread(), bIsMergeOperation ? FInstaLODCapture::EOperation::MeshMerge : FInstaLODCapture::EOperation::Remesh);
 	
 	// setup material data
 	InstaLOD::IInstaLODMaterialData *const MaterialData = InstaLOD->AllocMaterialData();
@@ -2899,14 +3706,22 @@ void FInstaLOD::ProxyLOD(
 	ConvertFlattenMaterialsToInstaLODMaterialData(InputMaterials, MaterialData, MaterialSettings);
 	
 	TArray<InstaLOD::IInstaLODMesh*> SourceInstaMeshes;
+	SourceInstaMeshes.SetNumUninitialized(InData.Num());
+
+	for (int32 DataIndex=0; DataIndex<InData.Num(); DataIndex++)
+	{
+		SourceInstaMeshes[DataIndex] = AllocInstaLODMesh();
+	}
 
-	for(int32 DataIndex=0; DataIndex<InData.Num(); DataIndex++)
+	// NOTE: every entry is converted into its own preallocated mesh, the meshes are added to the operation in the original order afterwards
+	ParallelFor(InData.Num(), [&](const int32 DataIndex)
 	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLOD::ProxyLOD::ConvertInput);
 		TMap<FName, int32> InMaterialMap;
 		TMap<int32, FName> OutMaterialMap;
 
 		UEInstaLODMeshHelper::CreateInputOutputMaterialMapFromMeshDescription(*InData[DataIndex].RawMesh, InMaterialMap, OutMaterialMap);
-		InstaLOD::IInstaLODMesh *const InstaMesh = AllocInstaLODMesh();
+		InstaLOD::IInstaLODMesh *const InstaMesh = SourceInstaMeshes[DataIndex];
 		UEInstaLODMeshHelper::MeshDescriptionToInstaLODMesh(*InData[DataIndex].RawMesh, InMaterialMap, InstaMesh);
 
 		// replace custom UVs when vertex colors needed baking
@@ -2917,34 +3732,49 @@ void FInstaLOD::ProxyLOD(
 			
 			if (NumTexCoordElems == InData[DataIndex].NewUVs.Num())
 			{
-				InstaMesh->ReverseFaceDirections(/*flipNormals:*/ false);
+				// NOTE: the UVs are in UE wedge order, write them reversed to match the InstaLOD winding
+				const UEInstaLODMeshHelper::FWindingRemap Remap((uint32)(NumTexCoordElems / 3u), /*bReverse:*/ true);
+				const auto& NewUVs = InData[DataIndex].NewUVs;
 
 				// we assume that these are for texcoord0
-				UEInstaLODMeshHelper::FillArray(OutTexcoords, InData[DataIndex].NewUVs.GetData(), NumTexCoordElems);
-				UEInstaLODMeshHelper::SanitizeFloatArray((float*)OutTexcoords, NumTexCoordElems * 2, 0.0f);
+				for (uint32 WedgeIndex=0u; WedgeIndex<NumTexCoordElems; WedgeIndex++)
+				{
+					OutTexcoords[Remap.Wedge(WedgeIndex)] = UEInstaLODMeshHelper::FVectorToInstaVec(FVector2f(NewUVs[WedgeIndex]));
+				}
 
-				InstaMesh->ReverseFaceDirections(/*flipNormals:*/ false);
+				UEInstaLODMeshHelper::FSanitizeReport SanitizeReport;
+				SanitizeReport.Sanitize(UEInstaLODMeshHelper::ESanitizeStream::TexCoords, OutTexcoords, NumTexCoordElems * 2);
+				SanitizeReport.Log(TEXT("proxy UV override"));
 			}
 		}
-		InstaOperation.AddMesh(InstaMesh);
-		SourceInstaMeshes.Add(InstaMesh);
+	}, UEInstaLODMeshHelper::IsParallelConversionDisabled());
+
+	for (int32 DataIndex=0; DataIndex<SourceInstaMeshes.Num(); DataIndex++)
+	{
+		InstaOperation.AddMesh(SourceInstaMeshes[DataIndex]);
+		Capture.AddMesh(SourceInstaMeshes[DataIndex], DataIndex == 0 ? MaterialData : nullptr);
 	}
 	
 	// create output mesh
 	InstaLOD::IInstaLODMesh *const OutputMesh = AllocInstaLODMesh();
 	
-	FMeshDescription OutProxyMesh;
 	FStaticMeshAttributes(OutProxyMesh).Register();
-	FFlattenMaterial OutMaterial; 
 
 	// execute InstaLOD merge operation
-	bool InstaOperationSuccess = InstaOperation.Execute(OutputMesh, InProxySettings);
+	bool InstaOperationSuccess = InstaOperation.Execute(OutputMesh, InProxySettings, &Capture);
+	
+	for (const InstaLOD::IInstaLODMesh *const SourceInstaMesh : SourceInstaMeshes)
+	{
+		StatsSample.Sample.InputTriangles += FInstaLODStats::GetTriangleCount(SourceInstaMesh);
+		StatsSample.Sample.MeshSizeInBytes = FMath::Max(StatsSample.Sample.MeshSizeInBytes, FInstaLODStats::GetMeshSizeInBytes(SourceInstaMesh));
+	}
+	StatsSample.Sample.OutputTriangles = InstaOperationSuccess ? FInstaLODStats::GetTriangleCount(OutputMesh) : 0u;
+	StatsSample.Sample.bSuccess = InstaOperationSuccess;
+	StatsSample.Sample.MessageCount = Context->GetCapturedMessageCount();
 	
 	if (!InstaOperationSuccess)
 	{
-		char InstaLog[8192];
-		InstaLOD->GetMessageLog(InstaLog, sizeof(InstaLog), nullptr);
-		UE_LOG(LogInstaLOD, Error, TEXT("Remeshing failed. Log: %s"), UTF8_TO_TCHAR(InstaLog));
+		UE_LOG(LogInstaLOD, Error, TEXT("Remeshing failed. Log: %s"), *Context->GetCapturedLog());
 	}
 	else
 	{
@@ -2963,20 +3793,26 @@ void FInstaLOD::ProxyLOD(
 
 	PostProcessMergedRawMesh(OutProxyMesh, OutMaterial, InProxySettings, ElapsedTime);
 	
+	// NOTE: key meshes generated without authorization must never be cached
+	if (bUseProxyCache && InstaOperationSuccess && InstaLOD->IsHostAuthorized())
+	{
+		const int64 MaxCacheSizeInBytes = (int64)FMath::Max(CVarLODCacheMaxSizeMB.GetValueOnAnyThread(), 0) * 1024 * 1024;
+		FInstaLODResultCache::Get().StoreProxy(OutProxyMesh, OutMaterial, ProxyCacheKey, MaxCacheSizeInBytes);
+	}
+	
 	// free data
 	for (int32 MeshIndex=0; MeshIndex<SourceInstaMeshes.Num(); MeshIndex++)
 	{
-		InstaLOD->DeallocMesh(SourceInstaMeshes[MeshIndex]);
+		DeallocInstaLODMesh(SourceInstaMeshes[MeshIndex]);
 	}
-	InstaLOD->DeallocMesh(OutputMesh);
+	DeallocInstaLODMesh(OutputMesh);
 	InstaLOD->DeallocMaterialData(MaterialData);
 	InstaOperation.Dealloc();
-	
-	CompleteDelegate.ExecuteIfBound(OutProxyMesh, OutMaterial, InJobGUID);
 }
 
 void FInstaLOD::PostProcessMergedRawMesh(FMeshDescription& OutProxyMesh, FFlattenMaterial& OutMaterial, const FMeshProxySettings& InProxySettings, const float ElapsedTime)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLOD::PostProcessMergedRawMesh);
 	IInstaLOD::UE_MaterialProxySettings MaterialSettings;
 	MaterialSettings = InProxySettings.MaterialSettings;
 	
@@ -3008,6 +3844,14 @@ void FInstaLOD::PostProcessMergedRawMesh(FMeshDescription& OutProxyMesh, FFlatte
 		SpecularSamples[0] = Specular.ToFColor(true);
 	}
 	
+	// NOTE: constant pages are collapsed to a single texel, the proxy material uses constants instead of textures for these pages
+	const int32 CollapsedPageCount = UEInstaLODMaterialHelper::CollapseConstantPages(OutMaterial, CVarConstantPageTolerance.GetValueOnAnyThread());
+	
+	if (CollapsedPageCount > 0)
+	{
+		UE_LOG(LogInstaLOD, Verbose, TEXT("Collapsed %d constant proxy material pages."), CollapsedPageCount);
+	}
+	
 	const FText DetailText = FText::FromString(FString::Printf(TEXT("in %.2fs"), ElapsedTime));
 	const FText NotificationText = FText::Format(LOCTEXT("LODPluginMergeComplete", "Built Proxy LOD {0}"), DetailText);
 	
@@ -3023,6 +3867,14 @@ void FInstaLOD::DispatchNotification(const FText& NotificationText, /*SNotificat
 	if (GEditor == nullptr)
 		return;
 	
+	// NOTE: reductions can run on async build tasks, the timer manager must only be accessed from the game thread
+	// the task doesn't capture the instance as it can be destroyed at module shutdown before the task runs
+	if (!IsInGameThread())
+	{
+		AsyncTask(ENamedThreads::GameThread, [NotificationText, type]() { FInstaLOD::DispatchNotification(NotificationText, type); });
+		return;
+	}
+	
 	// send a visual notification to the user
 	FNotificationInfo Info(NotificationText);
 	Info.ExpireDuration = 4.0f;
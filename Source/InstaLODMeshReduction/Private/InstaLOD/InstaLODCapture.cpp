@@ -0,0 +1,503 @@
+/**
+ * InstaLODCapture.cpp (InstaLOD)
+ *
+ * Copyright 2016-2023 InstaLOD GmbH - All Rights Reserved.
+ *
+ * Unauthorized copying of this file, via any medium is strictly prohibited.
+ * This file and all it's contents are proprietary and confidential.
+ *
+ * @file InstaLODCapture.cpp
+ * @copyright 2016-2023 InstaLOD GmbH. All rights reserved.
+ * @section License
+ */
+
+#include "InstaLODMeshReductionPCH.h"
+#include "InstaLOD/InstaLODCapture.h"
+
+#include "InstaLOD/InstaLODAPI.h"
+#include "InstaLOD/InstaLODStats.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+#include <atomic>
+#include <type_traits>
+
+namespace UEInstaLODCaptureHelper
+{
+	/** Increment when the manifest layout changes. */
+	static constexpr int32 kCaptureFormatVersion = 1;
+
+	static const TCHAR *const kManifestFileName = TEXT("Capture.json");
+	static const TCHAR *const kMeshExtension = TEXT(".InstaLODMesh");
+
+	/** NOTE: makes capture directories unique when multiple captures begin within the same timestamp. */
+	static std::atomic<uint32> CaptureCounter(0u);
+
+	static const TCHAR* GetOperationName(const FInstaLODCapture::EOperation Operation)
+	{
+		switch (Operation)
+		{
+			case FInstaLODCapture::EOperation::Optimize:			return TEXT("Optimize");
+			case FInstaLODCapture::EOperation::SkeletalOptimize:	return TEXT("SkeletalOptimize");
+			case FInstaLODCapture::EOperation::MeshMerge:			return TEXT("MeshMerge");
+			case FInstaLODCapture::EOperation::Remesh:				return TEXT("Remesh");
+		}
+		return TEXT("Unknown");
+	}
+
+	template<typename T>
+	static void WriteField(FJsonObject& Object, const TCHAR *const Name, const T& Value)
+	{
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			Object.SetBoolField(Name, Value);
+		}
+		else
+		{
+			Object.SetNumberField(Name, (double)Value);
+		}
+	}
+
+	template<typename T>
+	static void ReadField(const FJsonObject& Object, const TCHAR *const Name, T& Value)
+	{
+		if constexpr (std::is_same_v<T, bool>)
+		{
+			Object.TryGetBoolField(Name, Value);
+		}
+		else
+		{
+			double Number = 0.0;
+
+			if (Object.TryGetNumberField(Name, Number))
+			{
+				if constexpr (std::is_enum_v<T>)
+				{
+					Value = (T)(int64)Number;
+				}
+				else
+				{
+					Value = (T)Number;
+				}
+			}
+		}
+	}
+
+	/**
+	 * Visits all resolved fields of the optimize settings.
+	 * NOTE: the skeleton is referenced by pointer and is not part of captures, the skeletal reduction doesn't specify one.
+	 */
+	template<typename SettingsType, typename VisitorType>
+	static void VisitOptimizeSettings(SettingsType& Settings, VisitorType&& Visit)
+	{
+		Visit(TEXT("AlgorithmStrategy"), Settings.AlgorithmStrategy);
+		Visit(TEXT("AutomaticQuality"), Settings.AutomaticQuality);
+		Visit(TEXT("PercentTriangles"), Settings.PercentTriangles);
+		Visit(TEXT("AbsoluteTriangles"), Settings.AbsoluteTriangles);
+		Visit(TEXT("MaxDeviation"), Settings.MaxDeviation);
+		Visit(TEXT("WeldingThreshold"), Settings.WeldingThreshold);
+		Visit(TEXT("WeldingProtectDistinctUVShells"), Settings.WeldingProtectDistinctUVShells);
+		Visit(TEXT("WeldingNormalAngleThreshold"), Settings.WeldingNormalAngleThreshold);
+		Visit(TEXT("HealTJunctionThreshold"), Settings.HealTJunctionThreshold);
+		Visit(TEXT("ScreenSizeInPixels"), Settings.ScreenSizeInPixels);
+		Visit(TEXT("OptimizerVertexWeights"), Settings.OptimizerVertexWeights);
+		Visit(TEXT("OptimalPlacement"), Settings.OptimalPlacement);
+		Visit(TEXT("RecalculateNormals"), Settings.RecalculateNormals);
+		Visit(TEXT("HardAngleThreshold"), Settings.HardAngleThreshold);
+		Visit(TEXT("WeightedNormals"), Settings.WeightedNormals);
+		Visit(TEXT("NormalHealingMode"), Settings.NormalHealingMode);
+		Visit(TEXT("LockBoundaries"), Settings.LockBoundaries);
+		Visit(TEXT("LockSplits"), Settings.LockSplits);
+		Visit(TEXT("ProtectSplits"), Settings.ProtectSplits);
+		Visit(TEXT("ProtectBoundaries"), Settings.ProtectBoundaries);
+		Visit(TEXT("UnitScaleFactor"), Settings.UnitScaleFactor);
+		Visit(TEXT("NormalizeMeshScale"), Settings.NormalizeMeshScale);
+		Visit(TEXT("SkeletonOptimize.LeafBoneWeldDistance"), Settings.SkeletonOptimize.LeafBoneWeldDistance);
+		Visit(TEXT("SkeletonOptimize.MaximumBoneDepth"), Settings.SkeletonOptimize.MaximumBoneDepth);
+		Visit(TEXT("SkeletonOptimize.MaximumBoneInfluencesPerVertex"), Settings.SkeletonOptimize.MaximumBoneInfluencesPerVertex);
+		Visit(TEXT("SkeletonOptimize.MinimumBoneInfluenceThreshold"), Settings.SkeletonOptimize.MinimumBoneInfluenceThreshold);
+		Visit(TEXT("BoundaryImportance"), Settings.BoundaryImportance);
+		Visit(TEXT("TextureImportance"), Settings.TextureImportance);
+		Visit(TEXT("ShadingImportance"), Settings.ShadingImportance);
+		Visit(TEXT("SilhouetteImportance"), Settings.SilhouetteImportance);
+		Visit(TEXT("SkinningImportance"), Settings.SkinningImportance);
+		Visit(TEXT("Deterministic"), Settings.Deterministic);
+	}
+
+	/** NOTE: only the fields resolved by the plugin are visited, all other fields are SDK defaults. */
+	template<typename SettingsType, typename VisitorType>
+	static void VisitMeshMergeSettings(SettingsType& Settings, VisitorType&& Visit)
+	{
+		Visit(TEXT("SolidifyTexturePages"), Settings.SolidifyTexturePages);
+		Visit(TEXT("SuperSampling"), Settings.SuperSampling);
+		Visit(TEXT("GutterSizeInPixels"), Settings.GutterSizeInPixels);
+		Visit(TEXT("StackDuplicateShells"), Settings.StackDuplicateShells);
+		Visit(TEXT("Deterministic"), Settings.Deterministic);
+	}
+
+	/** NOTE: only the fields resolved by the plugin are visited, all other fields are SDK defaults. */
+	template<typename SettingsType, typename VisitorType>
+	static void VisitRemeshingSettings(SettingsType& Settings, VisitorType&& Visit)
+	{
+		Visit(TEXT("ScreenSizeInPixels"), Settings.ScreenSizeInPixels);
+		Visit(TEXT("HardAngleThreshold"), Settings.HardAngleThreshold);
+		Visit(TEXT("BakeOutput.TangentSpaceFormat"), Settings.BakeOutput.TangentSpaceFormat);
+		Visit(TEXT("BakeOutput.SuperSampling"), Settings.BakeOutput.SuperSampling);
+		Visit(TEXT("BakeOutput.TexturePageNormalTangentSpace"), Settings.BakeOutput.TexturePageNormalTangentSpace);
+		Visit(TEXT("BakeOutput.TexturePageNormalObjectSpace"), Settings.BakeOutput.TexturePageNormalObjectSpace);
+		Visit(TEXT("BakeAutomaticRayLengthFactor"), Settings.BakeAutomaticRayLengthFactor);
+		Visit(TEXT("ScreenSizePixelMergeDistance"), Settings.ScreenSizePixelMergeDistance);
+		Visit(TEXT("BakeEngine"), Settings.BakeEngine);
+		Visit(TEXT("SurfaceConstructionIgnoreBackface"), Settings.SurfaceConstructionIgnoreBackface);
+		Visit(TEXT("ScreenSizeInPixelsAutomaticTextureSize"), Settings.ScreenSizeInPixelsAutomaticTextureSize);
+		Visit(TEXT("Deterministic"), Settings.Deterministic);
+	}
+
+	template<typename SettingsType, typename VisitorFunctionType>
+	static TSharedRef<FJsonObject> WriteSettings(const SettingsType& Settings, VisitorFunctionType&& VisitSettings)
+	{
+		TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		VisitSettings(Settings, [&Object](const TCHAR *const Name, const auto& Value) { WriteField(*Object, Name, Value); });
+		return Object;
+	}
+
+	template<typename SettingsType, typename VisitorFunctionType>
+	static bool ReadSettings(const FJsonObject& Manifest, const TCHAR *const Name, SettingsType& OutSettings, VisitorFunctionType&& VisitSettings)
+	{
+		const TSharedPtr<FJsonObject>* Object = nullptr;
+
+		if (!Manifest.TryGetObjectField(Name, Object) || Object == nullptr || !Object->IsValid())
+			return false;
+
+		VisitSettings(OutSettings, [Object](const TCHAR *const FieldName, auto& Value) { ReadField(**Object, FieldName, Value); });
+		return true;
+	}
+
+	/** Deserializes a captured mesh. NOTE: a successfully loaded mesh must be deallocated by the caller. */
+	static InstaLOD::IInstaLODMesh* LoadMesh(InstaLOD::IInstaLOD *const InstaLOD, const FString& Path)
+	{
+		InstaLOD::IInstaLODMeshBase *const MeshBase = InstaLOD->DeserializeMesh(TCHAR_TO_UTF8(*Path), 0u);
+
+		if (MeshBase == nullptr)
+			return nullptr;
+
+		if (MeshBase->GetMeshType() != InstaLOD::IInstaLODMeshBase::MeshTypeTriangle)
+		{
+			InstaLOD->DeallocPolygonMesh(static_cast<InstaLOD::IInstaLODPolygonMesh*>(MeshBase));
+			return nullptr;
+		}
+		return static_cast<InstaLOD::IInstaLODMesh*>(MeshBase);
+	}
+}
+
+FInstaLODCapture::FInstaLODCapture(const FString& CaptureSetting, const EOperation InOperation) :
+Operation(InOperation),
+MeshCount(0)
+{
+	using namespace UEInstaLODCaptureHelper;
+
+	if (CaptureSetting.IsEmpty() || CaptureSetting == TEXT("0"))
+		return;
+
+	const FString CaptureRoot = CaptureSetting == TEXT("1") ? GetDefaultCaptureRoot() : CaptureSetting;
+	const FString CaptureName = FString::Printf(TEXT("%s-%s-%u-%u"), GetOperationName(Operation), *FDateTime::Now().ToString(),
+												FPlatformProcess::GetCurrentProcessId(), CaptureCounter++);
+
+	const FString CaptureDirectory = CaptureRoot / CaptureName;
+
+	if (!IFileManager::Get().MakeDirectory(*CaptureDirectory, /*Tree:*/ true))
+	{
+		UE_LOG(LogInstaLOD, Warning, TEXT("Failed to create capture directory '%s'."), *CaptureDirectory);
+		return;
+	}
+
+	Directory = CaptureDirectory;
+	Manifest = MakeShared<FJsonObject>();
+	Manifest->SetNumberField(TEXT("FormatVersion"), kCaptureFormatVersion);
+	Manifest->SetStringField(TEXT("Operation"), GetOperationName(Operation));
+	Manifest->SetStringField(TEXT("PluginVersion"), InstaLODShared::Version);
+	Manifest->SetArrayField(TEXT("Meshes"), TArray<TSharedPtr<FJsonValue>>());
+}
+
+FInstaLODCapture::~FInstaLODCapture()
+{
+	using namespace UEInstaLODCaptureHelper;
+
+	if (!IsActive())
+		return;
+
+	FString ManifestString;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ManifestString);
+
+	if (!FJsonSerializer::Serialize(Manifest.ToSharedRef(), Writer) ||
+		!FFileHelper::SaveStringToFile(ManifestString, *(Directory / kManifestFileName)))
+	{
+		UE_LOG(LogInstaLOD, Warning, TEXT("Failed to write capture manifest to '%s'."), *Directory);
+		return;
+	}
+
+	UE_LOG(LogInstaLOD, Log, TEXT("Captured %s to '%s'."), GetOperationName(Operation), *Directory);
+}
+
+void FInstaLODCapture::AddMesh(const InstaLOD::IInstaLODMesh *const Mesh, const InstaLOD::IInstaLODMaterialData *const MaterialData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLODCapture::AddMesh);
+	using namespace UEInstaLODCaptureHelper;
+	check(Mesh);
+
+	if (!IsActive())
+		return;
+
+	const FString FileName = FString::Printf(TEXT("Mesh%d%s"), MeshCount++, kMeshExtension);
+
+	if (!Mesh->Serialize(TCHAR_TO_UTF8(*(Directory / FileName)), MaterialData))
+	{
+		UE_LOG(LogInstaLOD, Warning, TEXT("Failed to write captured mesh '%s'."), *(Directory / FileName));
+		return;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> Meshes = Manifest->GetArrayField(TEXT("Meshes"));
+	Meshes.Add(MakeShared<FJsonValueString>(FileName));
+	Manifest->SetArrayField(TEXT("Meshes"), Meshes);
+
+	if (MaterialData != nullptr)
+	{
+		Manifest->SetStringField(TEXT("MaterialData"), FileName);
+	}
+}
+
+void FInstaLODCapture::SetOptimizeSettings(const InstaLOD::OptimizeSettings& Settings)
+{
+	using namespace UEInstaLODCaptureHelper;
+
+	if (!IsActive())
+		return;
+
+	const TSharedRef<FJsonObject> Object = WriteSettings(Settings, [](auto& InSettings, auto&& Visit) { VisitOptimizeSettings(InSettings, Visit); });
+
+	TArray<TSharedPtr<FJsonValue>> IgnoreJointIndices;
+	for (InstaLOD::uint32 Index=0u; Index<Settings.SkeletonOptimize.IgnoreJointIndicesCount; Index++)
+	{
+		IgnoreJointIndices.Add(MakeShared<FJsonValueNumber>(Settings.SkeletonOptimize.IgnoreJointIndices[Index]));
+	}
+	Object->SetArrayField(TEXT("SkeletonOptimize.IgnoreJointIndices"), IgnoreJointIndices);
+
+	Manifest->SetObjectField(TEXT("OptimizeSettings"), Object);
+}
+
+void FInstaLODCapture::SetMeshMergeSettings(const InstaLOD::MeshMergeSettings& Settings)
+{
+	using namespace UEInstaLODCaptureHelper;
+
+	if (!IsActive())
+		return;
+
+	Manifest->SetObjectField(TEXT("MeshMergeSettings"), WriteSettings(Settings, [](auto& InSettings, auto&& Visit) { VisitMeshMergeSettings(InSettings, Visit); }));
+}
+
+void FInstaLODCapture::SetRemeshingSettings(const InstaLOD::RemeshingSettings& Settings)
+{
+	using namespace UEInstaLODCaptureHelper;
+
+	if (!IsActive())
+		return;
+
+	Manifest->SetObjectField(TEXT("RemeshingSettings"), WriteSettings(Settings, [](auto& InSettings, auto&& Visit) { VisitRemeshingSettings(InSettings, Visit); }));
+}
+
+FString FInstaLODCapture::GetDefaultCaptureRoot()
+{
+	return FPaths::ProjectSavedDir() / TEXT("InstaLOD") / TEXT("Captures");
+}
+
+void FInstaLODCapture::FindCaptures(const FString& Path, TArray<FString>& OutCaptureDirectories)
+{
+	using namespace UEInstaLODCaptureHelper;
+
+	TArray<FString> ManifestPaths;
+	IFileManager::Get().FindFilesRecursive(ManifestPaths, *Path, kManifestFileName, /*Files:*/ true, /*Directories:*/ false);
+
+	OutCaptureDirectories.Reset(ManifestPaths.Num());
+	for (const FString& ManifestPath : ManifestPaths)
+	{
+		OutCaptureDirectories.Add(FPaths::GetPath(ManifestPath));
+	}
+	OutCaptureDirectories.Sort();
+}
+
+bool FInstaLODCapture::Replay(InstaLOD::IInstaLOD *const InstaLOD, const FString& CaptureDirectory, FReplayResult& OutResult)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLODCapture::Replay);
+	using namespace UEInstaLODCaptureHelper;
+	check(InstaLOD);
+
+	OutResult = FReplayResult();
+
+	FString ManifestString;
+	TSharedPtr<FJsonObject> Manifest;
+
+	if (!FFileHelper::LoadFileToString(ManifestString, *(CaptureDirectory / kManifestFileName)) ||
+		!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ManifestString), Manifest) || !Manifest.IsValid())
+	{
+		OutResult.Error = TEXT("Missing or invalid capture manifest.");
+		return false;
+	}
+
+	int32 FormatVersion = 0;
+	if (!Manifest->TryGetNumberField(TEXT("FormatVersion"), FormatVersion) || FormatVersion != kCaptureFormatVersion)
+	{
+		OutResult.Error = FString::Printf(TEXT("Unsupported capture format version %d."), FormatVersion);
+		return false;
+	}
+
+	OutResult.Operation = Manifest->GetStringField(TEXT("Operation"));
+
+	// load inputs
+	TArray<InstaLOD::IInstaLODMesh*> InputMeshes;
+	InstaLOD::IInstaLODMaterialData* MaterialData = nullptr;
+
+	ON_SCOPE_EXIT
+	{
+		for (InstaLOD::IInstaLODMesh *const InputMesh : InputMeshes)
+		{
+			InstaLOD->DeallocMesh(InputMesh);
+		}
+		if (MaterialData != nullptr)
+		{
+			InstaLOD->DeallocMaterialData(MaterialData);
+		}
+	};
+
+	for (const TSharedPtr<FJsonValue>& MeshValue : Manifest->GetArrayField(TEXT("Meshes")))
+	{
+		InstaLOD::IInstaLODMesh *const InputMesh = LoadMesh(InstaLOD, CaptureDirectory / MeshValue->AsString());
+
+		if (InputMesh == nullptr)
+		{
+			OutResult.Error = FString::Printf(TEXT("Failed to load captured mesh '%s'."), *MeshValue->AsString());
+			return false;
+		}
+
+		InputMeshes.Add(InputMesh);
+		OutResult.InputTriangles += FInstaLODStats::GetTriangleCount(InputMesh);
+	}
+
+	if (InputMeshes.Num() == 0)
+	{
+		OutResult.Error = TEXT("The capture does not contain any meshes.");
+		return false;
+	}
+
+	FString MaterialDataFileName;
+	if (Manifest->TryGetStringField(TEXT("MaterialData"), MaterialDataFileName))
+	{
+		MaterialData = InstaLOD->DeserializeMaterialData(TCHAR_TO_UTF8(*(CaptureDirectory / MaterialDataFileName)));
+
+		if (MaterialData == nullptr)
+		{
+			OutResult.Error = FString::Printf(TEXT("Failed to load captured material data '%s'."), *MaterialDataFileName);
+			return false;
+		}
+	}
+
+	// resolve settings
+	InstaLOD::OptimizeSettings OptimizeSettings;
+	TArray<InstaLOD::uint32> IgnoreJointIndices;
+	const bool bHasOptimizeSettings = ReadSettings(*Manifest, TEXT("OptimizeSettings"), OptimizeSettings, [](auto& InSettings, auto&& Visit) { VisitOptimizeSettings(InSettings, Visit); });
+
+	if (bHasOptimizeSettings)
+	{
+		for (const TSharedPtr<FJsonValue>& IndexValue : Manifest->GetObjectField(TEXT("OptimizeSettings"))->GetArrayField(TEXT("SkeletonOptimize.IgnoreJointIndices")))
+		{
+			IgnoreJointIndices.Add((InstaLOD::uint32)IndexValue->AsNumber());
+		}
+
+		OptimizeSettings.SkeletonOptimize.IgnoreJointIndices = IgnoreJointIndices.Num() > 0 ? IgnoreJointIndices.GetData() : nullptr;
+		OptimizeSettings.SkeletonOptimize.IgnoreJointIndicesCount = IgnoreJointIndices.Num();
+	}
+
+	// execute
+	InstaLOD::IInstaLODMesh *const OutputMesh = InstaLOD->AllocMesh();
+	ON_SCOPE_EXIT
+	{
+		InstaLOD->DeallocMesh(OutputMesh);
+	};
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	if (OutResult.Operation == TEXT("Optimize") || OutResult.Operation == TEXT("SkeletalOptimize"))
+	{
+		if (!bHasOptimizeSettings)
+		{
+			OutResult.Error = TEXT("The capture does not contain optimize settings.");
+			return false;
+		}
+
+		OutResult.bSuccess = InstaLOD->Optimize(InputMeshes[0], OutputMesh, OptimizeSettings).Success;
+	}
+	else if (OutResult.Operation == TEXT("MeshMerge"))
+	{
+		InstaLOD::MeshMergeSettings MeshMergeSettings;
+		ReadSettings(*Manifest, TEXT("MeshMergeSettings"), MeshMergeSettings, [](auto& InSettings, auto&& Visit) { VisitMeshMergeSettings(InSettings, Visit); });
+
+		InstaLOD::IMeshMergeOperation2 *const MergeOperation = InstaLOD->AllocMeshMergeOperation();
+
+		for (InstaLOD::IInstaLODMesh *const InputMesh : InputMeshes)
+		{
+			MergeOperation->AddMesh(InputMesh);
+		}
+		if (MaterialData != nullptr)
+		{
+			MergeOperation->SetMaterialData(MaterialData);
+		}
+
+		OutResult.bSuccess = MergeOperation->Execute(OutputMesh, MeshMergeSettings).Success;
+		InstaLOD->DeallocMeshMergeOperation(MergeOperation);
+
+		// NOTE: merged proxies are optimized afterwards if optimize settings have been captured
+		if (OutResult.bSuccess && bHasOptimizeSettings)
+		{
+			OutResult.bSuccess = InstaLOD->Optimize(OutputMesh, OutputMesh, OptimizeSettings).Success;
+		}
+	}
+	else if (OutResult.Operation == TEXT("Remesh"))
+	{
+		InstaLOD::RemeshingSettings RemeshingSettings;
+		ReadSettings(*Manifest, TEXT("RemeshingSettings"), RemeshingSettings, [](auto& InSettings, auto&& Visit) { VisitRemeshingSettings(InSettings, Visit); });
+
+		InstaLOD::IRemeshingOperation *const RemeshOperation = InstaLOD->AllocRemeshingOperation();
+
+		for (InstaLOD::IInstaLODMesh *const InputMesh : InputMeshes)
+		{
+			RemeshOperation->AddMesh(InputMesh);
+		}
+		if (MaterialData != nullptr)
+		{
+			RemeshOperation->SetMaterialData(MaterialData);
+		}
+
+		OutResult.bSuccess = RemeshOperation->Execute(OutputMesh, RemeshingSettings).Success;
+		InstaLOD->DeallocRemeshingOperation(RemeshOperation);
+	}
+	else
+	{
+		OutResult.Error = FString::Printf(TEXT("Unknown capture operation '%s'."), *OutResult.Operation);
+		return false;
+	}
+
+	OutResult.WallTimeInSeconds = FPlatformTime::Seconds() - StartTime;
+	OutResult.OutputTriangles = OutResult.bSuccess ? FInstaLODStats::GetTriangleCount(OutputMesh) : 0u;
+
+	if (!OutResult.bSuccess)
+	{
+		OutResult.Error = TEXT("The operation failed.");
+	}
+	return OutResult.bSuccess;
+}
@@ -0,0 +1,131 @@
+/**
+ * InstaLODExecutionContext.cpp (InstaLOD)
+ *
+ * Copyright 2016-2023 InstaLOD GmbH - All Rights Reserved.
+ *
+ * Unauthorized copying of this file, via any medium is strictly prohibited.
+ * This file and all it's contents are proprietary and confidential.
+ *
+ * @file InstaLODExecutionContext.cpp
+ * @copyright 2016-2023 InstaLOD GmbH. All rights reserved.
+ * @section License
+ */
+
+#include "InstaLODMeshReductionPCH.h"
+#include "InstaLOD/InstaLODExecutionContext.h"
+
+#include "InstaLOD/InstaLODAPI.h"
+#include "InstaLOD/InstaLODLogSink.h"
+
+#include "Misc/ScopeLock.h"
+
+FInstaLODExecutionContext::FInstaLODExecutionContext(InstaLOD::IInstaLOD *const InInstaLOD, FInstaLODLogSink *const InLogSink) :
+InstaLOD(InInstaLOD),
+LogSink(InLogSink),
+OptimizeOperation(nullptr),
+LogCaptureOffset(0u),
+OperationID(0u)
+{
+	check(InstaLOD);
+}
+
+FInstaLODExecutionContext::~FInstaLODExecutionContext()
+{
+	EndLogCapture();
+
+	if (OptimizeOperation != nullptr)
+	{
+		InstaLOD->DeallocOptimizeOperation(OptimizeOperation);
+	}
+}
+
+InstaLOD::IOptimizeOperation* FInstaLODExecutionContext::GetOptimizeOperation()
+{
+	if (OptimizeOperation == nullptr)
+	{
+		OptimizeOperation = InstaLOD->AllocOptimizeOperation();
+	}
+	return OptimizeOperation;
+}
+
+void FInstaLODExecutionContext::BeginLogCapture()
+{
+	if (LogSink != nullptr)
+	{
+		EndLogCapture();
+		OperationID = LogSink->BeginCapture();
+		return;
+	}
+
+	InstaLOD::uint64 LogSize = 0u;
+	InstaLOD->GetMessageLog(nullptr, 0u, &LogSize);
+	LogCaptureOffset = LogSize;
+}
+
+void FInstaLODExecutionContext::EndLogCapture()
+{
+	if (LogSink != nullptr && OperationID != 0u)
+	{
+		LogSink->EndCapture(OperationID);
+		OperationID = 0u;
+	}
+}
+
+FString FInstaLODExecutionContext::GetCapturedLog() const
+{
+	if (LogSink != nullptr)
+		return OperationID != 0u ? LogSink->GetCapturedLog(OperationID) : FString();
+
+	InstaLOD::uint64 LogSize = 0u;
+	InstaLOD->GetMessageLog(nullptr, 0u, &LogSize);
+
+	// NOTE: the message log may have been cleared since the capture began
+	const InstaLOD::uint64 CaptureOffset = LogSize >= LogCaptureOffset ? LogCaptureOffset : 0u;
+
+	if (LogSize <= CaptureOffset)
+		return FString();
+
+	TArray<ANSICHAR> Log;
+	Log.SetNumZeroed((int32)LogSize + 1);
+	const InstaLOD::uint64 BytesWritten = InstaLOD->GetMessageLog(Log.GetData(), (InstaLOD::uint64)Log.Num(), nullptr);
+
+	if (BytesWritten <= CaptureOffset)
+		return FString();
+
+	// NOTE: the log may have grown after querying its size, the buffer is always null terminated
+	Log.Last() = '\0';
+	return FString(UTF8_TO_TCHAR(Log.GetData() + CaptureOffset));
+}
+
+uint32 FInstaLODExecutionContext::GetCapturedMessageCount() const
+{
+	return LogSink != nullptr && OperationID != 0u ? LogSink->GetCapturedMessageCount(OperationID) : 0u;
+}
+
+FInstaLODExecutionContextPool::FInstaLODExecutionContextPool(InstaLOD::IInstaLOD *const InInstaLOD, FInstaLODLogSink *const InLogSink) :
+InstaLOD(InInstaLOD),
+LogSink(InLogSink)
+{
+}
+
+FInstaLODExecutionContextPool::~FInstaLODExecutionContextPool()
+{
+	check(FreeContexts.Num() == Contexts.Num());
+}
+
+FInstaLODExecutionContext& FInstaLODExecutionContextPool::Acquire()
+{
+	FScopeLock ScopeLock(&Lock);
+
+	if (FreeContexts.Num() > 0)
+		return *FreeContexts.Pop(false);
+
+	Contexts.Add(MakeUnique<FInstaLODExecutionContext>(InstaLOD, LogSink));
+	return *Contexts.Last();
+}
+
+void FInstaLODExecutionContextPool::Release(FInstaLODExecutionContext& Context)
+{
+	FScopeLock ScopeLock(&Lock);
+	FreeContexts.Push(&Context);
+}
@@ -0,0 +1,123 @@
+/**
+ * InstaLODExecutionContext.h (InstaLOD)
+ *
+ * Copyright 2016-2023 InstaLOD GmbH - All Rights Reserved.
+ *
+ * Unauthorized copying of this file, via any medium is strictly prohibited.
+ * This file and all it's contents are proprietary and confidential.
+ *
+ * @file InstaLODExecutionContext.h
+ * @copyright 2016-2023 InstaLOD GmbH. All rights reserved.
+ * @section License
+ */
+
+#ifndef InstaLOD_InstaLODExecutionContext_h
+#define InstaLOD_InstaLODExecutionContext_h
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+namespace InstaLOD
+{
+	class IInstaLOD;
+	class IOptimizeOperation;
+};
+
+class FInstaLODLogSink;
+
+/**
+ * Per-worker state for running InstaLOD operations concurrently on the shared InstaLOD API instance.
+ *
+ * Thread-safety contract:
+ * - Meshes, skeletons and operations can be allocated and deallocated from any thread.
+ * - Each mesh and operation must only be used by one thread at a time. Multiple operations may read the same input mesh concurrently.
+ * - The SDK keeps a single message log per InstaLOD API instance. Contexts capture the messages appended to it while they
+ *   are active, messages of operations running concurrently on other contexts can be part of the captured log.
+ *   If a log sink is available, the messages are captured from the streamed SDK output instead, the captured and forwarded
+ *   lines are correlated with whichever operations were running when they were written and are not attributed to a single context.
+ * - Global SDK state (authorization, standard output, clearing the message log) must only be modified from the game thread.
+ * - Editor notifications must be dispatched through FInstaLOD::DispatchNotification, which forwards them to the game thread.
+ */
+class FInstaLODExecutionContext
+{
+public:
+	FInstaLODExecutionContext(InstaLOD::IInstaLOD *const InstaLOD, FInstaLODLogSink *const LogSink);
+	~FInstaLODExecutionContext();
+
+	/** Gets the optimize operation of this context, the operation is allocated on first use and reused by subsequent acquisitions. */
+	InstaLOD::IOptimizeOperation* GetOptimizeOperation();
+
+	/** Starts capturing the messages appended to the SDK message log. */
+	void BeginLogCapture();
+
+	/** Stops capturing the messages. */
+	void EndLogCapture();
+
+	/** Gets the messages appended to the SDK message log since BeginLogCapture. */
+	FString GetCapturedLog() const;
+
+	/** Gets the amount of messages captured since BeginLogCapture, only available if the SDK output is streamed to a log sink. */
+	uint32 GetCapturedMessageCount() const;
+
+	/** Gets the operation ID listed by the streamed SDK output while the current capture is active, 0 if the output isn't streamed. */
+	uint32 GetOperationID() const { return OperationID; }
+
+private:
+	InstaLOD::IInstaLOD *const InstaLOD;
+	FInstaLODLogSink *const LogSink;
+	InstaLOD::IOptimizeOperation *OptimizeOperation;
+	uint64 LogCaptureOffset;	/**< Size of the SDK message log when the capture began. */
+	uint32 OperationID;			/**< Log sink capture of the current operation. */
+};
+
+/**
+ * Pool of execution contexts, contexts are created on demand and reused once released.
+ * NOTE: all methods are thread-safe.
+ */
+class FInstaLODExecutionContextPool
+{
+public:
+	FInstaLODExecutionContextPool(InstaLOD::IInstaLOD *const InstaLOD, FInstaLODLogSink *const LogSink);
+	~FInstaLODExecutionContextPool();
+
+	FInstaLODExecutionContext& Acquire();
+	void Release(FInstaLODExecutionContext& Context);
+
+private:
+	InstaLOD::IInstaLOD *const InstaLOD;
+	FInstaLODLogSink *const LogSink;
+
+	FCriticalSection Lock;
+	TArray<TUniquePtr<FInstaLODExecutionContext>> Contexts;
+	TArray<FInstaLODExecutionContext*> FreeContexts;
+};
+
+/** Acquires an execution context from the pool for the lifetime of the scope and begins capturing the message log. */
+class FInstaLODScopedExecutionContext
+{
+public:
+	explicit FInstaLODScopedExecutionContext(FInstaLODExecutionContextPool& InPool) :
+	Pool(InPool),
+	Context(InPool.Acquire())
+	{
+		Context.BeginLogCapture();
+	}
+
+	~FInstaLODScopedExecutionContext()
+	{
+		Context.EndLogCapture();
+		Pool.Release(Context);
+	}
+
+	FInstaLODExecutionContext* operator->() const { return &Context; }
+	FInstaLODExecutionContext& operator*() const { return Context; }
+
+private:
+	FInstaLODScopedExecutionContext(const FInstaLODScopedExecutionContext&) = delete;
+	FInstaLODScopedExecutionContext& operator=(const FInstaLODScopedExecutionContext&) = delete;
+
+	FInstaLODExecutionContextPool& Pool;
+	FInstaLODExecutionContext& Context;
+};
+
+#endif
@@ -0,0 +1,320 @@
+/**
+ * InstaLODLogSink.cpp (InstaLOD)
+ *
+ * Copyright 2016-2023 InstaLOD GmbH - All Rights Reserved.
+ *
+ * Unauthorized copying of this file, via any medium is strictly prohibited.
+ * This file and all it's contents are proprietary and confidential.
+ *
+ * @file InstaLODLogSink.cpp
+ * @copyright 2016-2023 InstaLOD GmbH. All rights reserved.
+ * @section License
+ */
+
+#include "InstaLODMeshReductionPCH.h"
+#include "InstaLOD/InstaLODLogSink.h"
+
+#include "InstaLOD/InstaLODAPI.h"
+
+#include "HAL/IConsoleManager.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/ScopeLock.h"
+#include "ProfilingDebugging/CountersTrace.h"
+
+// NOTE: InstaLOD.dll is linked against its own C runtime on Windows, therefore streams can't be shared with the SDK
+#define INSTALOD_LOG_SINK_SUPPORTED (PLATFORM_LINUX || PLATFORM_MAC)
+
+#if INSTALOD_LOG_SINK_SUPPORTED
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#endif
+
+TRACE_DECLARE_INT_COUNTER(InstaLODLogMessages, TEXT("InstaLOD/LogMessages"));
+
+namespace UEInstaLODLogSinkHelper
+{
+	/** Amount of bytes read from a pipe at once. */
+	static constexpr int32 ReadChunkSize = 4096;
+
+	/** Interval in which the reader thread checks whether the sink is stopping. */
+	static constexpr int32 PollTimeoutInMilliseconds = 100;
+
+	static bool IsForwardingToLog()
+	{
+		static const TConsoleVariableData<int32>* const LogStreamCVar = IConsoleManager::Get().FindTConsoleVariableDataInt(TEXT("InstaLOD.LogStream"));
+		return LogStreamCVar == nullptr || LogStreamCVar->GetValueOnAnyThread() != 0;
+	}
+}
+
+TUniquePtr<FInstaLODLogSink> FInstaLODLogSink::Create(InstaLOD::IInstaLOD *const InstaLOD)
+{
+	check(InstaLOD);
+
+#if INSTALOD_LOG_SINK_SUPPORTED
+	TUniquePtr<FInstaLODLogSink> LogSink(new FInstaLODLogSink(InstaLOD));
+
+	if (!LogSink->OpenStream(LogSink->Streams[0], (const FILE*)1, false) ||
+		!LogSink->OpenStream(LogSink->Streams[1], (const FILE*)2, true))
+	{
+		UE_LOG(LogInstaLOD, Warning, TEXT("Failed to redirect the InstaLOD output streams, falling back to the message log."));
+		return nullptr;
+	}
+
+	LogSink->Thread = FRunnableThread::Create(LogSink.Get(), TEXT("InstaLODLogSink"), 0, TPri_BelowNormal);
+
+	if (LogSink->Thread == nullptr)
+		return nullptr;
+
+	return LogSink;
+#else
+	return nullptr;
+#endif
+}
+
+FInstaLODLogSink::FInstaLODLogSink(InstaLOD::IInstaLOD *const InInstaLOD) :
+InstaLOD(InInstaLOD),
+Thread(nullptr),
+bIsStopping(false),
+NextOperationID(1u)
+{
+}
+
+FInstaLODLogSink::~FInstaLODLogSink()
+{
+	if (Thread != nullptr)
+	{
+		Thread->Kill(true);
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	// NOTE: the streams are restored first, so that the SDK doesn't write into closed pipes
+	for (FStream& Stream : Streams)
+	{
+		if (Stream.bIsRedirected)
+		{
+			InstaLOD->SetOutputStream(Stream.PreviousStream, Stream.Type);
+			Stream.bIsRedirected = false;
+		}
+	}
+
+	Flush();
+
+	for (FStream& Stream : Streams)
+	{
+		CloseStream(Stream);
+	}
+}
+
+bool FInstaLODLogSink::OpenStream(FStream& Stream, const FILE* Type, const bool bIsErrorStream)
+{
+	Stream.Type = Type;
+	Stream.bIsErrorStream = bIsErrorStream;
+
+#if INSTALOD_LOG_SINK_SUPPORTED
+	int Pipe[2];
+
+	if (pipe(Pipe) != 0)
+		return false;
+
+	fcntl(Pipe[0], F_SETFL, fcntl(Pipe[0], F_GETFL) | O_NONBLOCK);
+	fcntl(Pipe[0], F_SETFD, FD_CLOEXEC);
+	fcntl(Pipe[1], F_SETFD, FD_CLOEXEC);
+
+	Stream.ReadHandle = Pipe[0];
+	Stream.Writer = fdopen(Pipe[1], "w");
+
+	if (Stream.Writer == nullptr)
+	{
+		close(Pipe[1]);
+		return false;
+	}
+
+	// NOTE: line buffering hands every complete message to the reader thread without an explicit flush
+	setvbuf(Stream.Writer, nullptr, _IOLBF, BUFSIZ);
+
+	Stream.PreviousStream = InstaLOD->GetOutputStream((FILE*)Type);
+
+	if (Stream.PreviousStream == nullptr)
+	{
+		Stream.PreviousStream = Type == (const FILE*)1 ? stdout : stderr;
+	}
+
+	Stream.bIsRedirected = InstaLOD->SetOutputStream(Stream.Writer, Type);
+	return Stream.bIsRedirected;
+#else
+	return false;
+#endif
+}
+
+void FInstaLODLogSink::CloseStream(FStream& Stream)
+{
+#if INSTALOD_LOG_SINK_SUPPORTED
+	if (Stream.Writer != nullptr)
+	{
+		fclose(Stream.Writer);
+		Stream.Writer = nullptr;
+	}
+	if (Stream.ReadHandle >= 0)
+	{
+		close(Stream.ReadHandle);
+		Stream.ReadHandle = -1;
+	}
+#endif
+}
+
+uint32 FInstaLODLogSink::BeginCapture()
+{
+	// NOTE: output written before the capture began must not be attributed to the new operation
+	Flush();
+
+	FScopeLock ScopeLock(&Lock);
+	const uint32 OperationID = NextOperationID++;
+	Captures.Add(OperationID);
+	return OperationID;
+}
+
+void FInstaLODLogSink::EndCapture(const uint32 OperationID)
+{
+	FScopeLock ScopeLock(&Lock);
+	Captures.Remove(OperationID);
+}
+
+FString FInstaLODLogSink::GetCapturedLog(const uint32 OperationID)
+{
+	Flush();
+
+	FScopeLock ScopeLock(&Lock);
+	const FCapture *const Capture = Captures.Find(OperationID);
+	return Capture != nullptr ? Capture->Log : FString();
+}
+
+uint32 FInstaLODLogSink::GetCapturedMessageCount(const uint32 OperationID)
+{
+	Flush();
+
+	FScopeLock ScopeLock(&Lock);
+	const FCapture *const Capture = Captures.Find(OperationID);
+	return Capture != nullptr ? Capture->MessageCount : 0u;
+}
+
+void FInstaLODLogSink::Flush()
+{
+	// NOTE: the writers must be flushed without holding the lock, a full pipe blocks until the reader thread drained it
+	for (FStream& Stream : Streams)
+	{
+		if (Stream.Writer != nullptr)
+		{
+			fflush(Stream.Writer);
+		}
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	for (FStream& Stream : Streams)
+	{
+		DrainStream(Stream);
+	}
+}
+
+uint32 FInstaLODLogSink::Run()
+{
+#if INSTALOD_LOG_SINK_SUPPORTED
+	while (!bIsStopping)
+	{
+		pollfd PollHandles[UE_ARRAY_COUNT(Streams)];
+
+		for (int32 StreamIndex=0; StreamIndex<UE_ARRAY_COUNT(Streams); StreamIndex++)
+		{
+			PollHandles[StreamIndex].fd = Streams[StreamIndex].ReadHandle;
+			PollHandles[StreamIndex].events = POLLIN;
+			PollHandles[StreamIndex].revents = 0;
+		}
+
+		if (poll(PollHandles, UE_ARRAY_COUNT(Streams), UEInstaLODLogSinkHelper::PollTimeoutInMilliseconds) <= 0)
+			continue;
+
+		FScopeLock ScopeLock(&Lock);
+		for (FStream& Stream : Streams)
+		{
+			DrainStream(Stream);
+		}
+	}
+#endif
+	return 0;
+}
+
+void FInstaLODLogSink::Stop()
+{
+	bIsStopping = true;
+}
+
+void FInstaLODLogSink::DrainStream(FStream& Stream)
+{
+#if INSTALOD_LOG_SINK_SUPPORTED
+	if (Stream.ReadHandle < 0)
+		return;
+
+	ANSICHAR Chunk[UEInstaLODLogSinkHelper::ReadChunkSize];
+
+	for (;;)
+	{
+		const ssize_t BytesRead = read(Stream.ReadHandle, Chunk, sizeof(Chunk));
+
+		// NOTE: the pipe is non-blocking, the read fails with EAGAIN once all output has been read
+		if (BytesRead <= 0)
+			break;
+
+		int32 LineStart = 0;
+		for (int32 ByteIndex=0; ByteIndex<(int32)BytesRead; ByteIndex++)
+		{
+			if (Chunk[ByteIndex] != '\n')
+				continue;
+
+			Stream.PendingLine.Append(Chunk + LineStart, ByteIndex - LineStart);
+			DispatchLine(Stream);
+			LineStart = ByteIndex + 1;
+		}
+		Stream.PendingLine.Append(Chunk + LineStart, (int32)BytesRead - LineStart);
+	}
+#endif
+}
+
+void FInstaLODLogSink::DispatchLine(FStream& Stream)
+{
+	while (Stream.PendingLine.Num() > 0 && (Stream.PendingLine.Last() == '\r' || Stream.PendingLine.Last() == ' '))
+	{
+		Stream.PendingLine.Pop(false);
+	}
+
+	if (Stream.PendingLine.Num() == 0)
+		return;
+
+	Stream.PendingLine.Add('\0');
+	const FString Line = UTF8_TO_TCHAR(Stream.PendingLine.GetData());
+	Stream.PendingLine.Reset();
+
+	FString Tag;
+	for (TPair<uint32, FCapture>& Capture : Captures)
+	{
+		Capture.Value.Log += Line;
+		Capture.Value.Log += TEXT("\n");
+		Capture.Value.MessageCount++;
+
+		Tag += FString::Printf(Tag.IsEmpty() ? TEXT(" #%u") : TEXT(",#%u"), Capture.Key);
+	}
+
+	TRACE_COUNTER_INCREMENT(InstaLODLogMessages);
+
+	if (!UEInstaLODLogSinkHelper::IsForwardingToLog())
+		return;
+
+	if (Stream.bIsErrorStream)
+	{
+		UE_LOG(LogInstaLOD, Display, TEXT("[SDK%s] %s"), *Tag, *Line);
+	}
+	else
+	{
+		UE_LOG(LogInstaLOD, Log, TEXT("[SDK%s] %s"), *Tag, *Line);
+	}
+}
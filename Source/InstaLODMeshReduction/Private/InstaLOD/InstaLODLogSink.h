@@ -0,0 +1,115 @@
+/**
+ * InstaLODLogSink.h (InstaLOD)
+ *
+ * Copyright 2016-2023 InstaLOD GmbH - All Rights Reserved.
+ *
+ * Unauthorized copying of this file, via any medium is strictly prohibited.
+ * This file and all it's contents are proprietary and confidential.
+ *
+ * @file InstaLODLogSink.h
+ * @copyright 2016-2023 InstaLOD GmbH. All rights reserved.
+ * @section License
+ */
+
+#ifndef InstaLOD_InstaLODLogSink_h
+#define InstaLOD_InstaLODLogSink_h
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "HAL/Runnable.h"
+
+#include <atomic>
+#include <stdio.h>
+
+class FRunnableThread;
+
+namespace InstaLOD
+{
+	class IInstaLOD;
+};
+
+/**
+ * Streams the output of the InstaLOD SDK into LogInstaLOD while it is written.
+ * The stdout and stderr streams of the SDK are redirected into pipes that are drained by a reader thread,
+ * each line is forwarded as soon as it is complete and lines written to stderr are logged with display verbosity.
+ * NOTE: stderr output is not logged as a warning, so that builds treating warnings as errors don't fail on SDK diagnostics.
+ * Operations capture the output with BeginCapture. The SDK output can't be attributed to a single operation:
+ * every line is appended to all captures that are active when the line is read and the forwarded line lists the
+ * operation IDs of these captures, so lines are correlated with whichever operations were running.
+ * NOTE: the sink is only available on platforms where the SDK shares the C runtime of the editor.
+ * NOTE: all methods are thread-safe.
+ */
+class FInstaLODLogSink : public FRunnable
+{
+public:
+	/**
+	 * Redirects the output streams of the SDK into a new sink.
+	 *
+	 * @param InstaLOD the InstaLOD API.
+	 * @return the sink or nullptr if the output streams can't be redirected on this platform.
+	 */
+	static TUniquePtr<FInstaLODLogSink> Create(InstaLOD::IInstaLOD *const InstaLOD);
+
+	/** Restores the output streams of the SDK and forwards the remaining output. */
+	virtual ~FInstaLODLogSink();
+
+	/** Starts capturing the SDK output, returns the operation ID of the capture. */
+	uint32 BeginCapture();
+
+	/** Stops capturing and discards the captured output. */
+	void EndCapture(const uint32 OperationID);
+
+	/** Gets the SDK output captured since BeginCapture, including all output written before this call. */
+	FString GetCapturedLog(const uint32 OperationID);
+
+	/** Gets the amount of lines captured since BeginCapture, including all output written before this call. */
+	uint32 GetCapturedMessageCount(const uint32 OperationID);
+
+	/** Forwards all output that has been written by the SDK. */
+	void Flush();
+
+	//~ Begin FRunnable Interface
+	virtual uint32 Run() override;
+	virtual void Stop() override;
+	//~ End FRunnable Interface
+
+private:
+	/** A redirected SDK output stream. */
+	struct FStream
+	{
+		const FILE* Type = nullptr;			/**< The SDK stream type, (FILE*)1 for stdout and (FILE*)2 for stderr. */
+		FILE* PreviousStream = nullptr;		/**< The stream used by the SDK before it was redirected. */
+		FILE* Writer = nullptr;				/**< The write end of the pipe, used by the SDK. */
+		int32 ReadHandle = -1;				/**< The non-blocking read end of the pipe. */
+		bool bIsRedirected = false;
+		bool bIsErrorStream = false;		/**< Whether the stream is stderr, its lines are logged with display verbosity. */
+		TArray<ANSICHAR> PendingLine;		/**< Output read after the last complete line. */
+	};
+
+	/** The output captured by a single operation. */
+	struct FCapture
+	{
+		FString Log;
+		uint32 MessageCount = 0u;
+	};
+
+	explicit FInstaLODLogSink(InstaLOD::IInstaLOD *const InInstaLOD);
+
+	bool OpenStream(FStream& Stream, const FILE* Type, const bool bIsErrorStream);
+	void CloseStream(FStream& Stream);
+
+	/** Reads all available output of the stream and forwards the complete lines. NOTE: the lock must be held. */
+	void DrainStream(FStream& Stream);
+	void DispatchLine(FStream& Stream);
+
+	InstaLOD::IInstaLOD *const InstaLOD;
+	FRunnableThread* Thread;
+	std::atomic<bool> bIsStopping;
+
+	FCriticalSection Lock;
+	FStream Streams[2];
+	TMap<uint32, FCapture> Captures;
+	uint32 NextOperationID;
+};
+
+#endif
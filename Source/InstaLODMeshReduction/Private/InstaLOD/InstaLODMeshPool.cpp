@@ -0,0 +1,200 @@
+/**
+ * InstaLODMeshPool.cpp (InstaLOD)
+ *
+ * Copyright 2016-2023 InstaLOD GmbH - All Rights Reserved.
+ *
+ * Unauthorized copying of this file, via any medium is strictly prohibited.
+ * This file and all it's contents are proprietary and confidential.
+ *
+ * @file InstaLODMeshPool.cpp
+ * @copyright 2016-2023 InstaLOD GmbH. All rights reserved.
+ * @section License
+ */
+
+#include "InstaLODMeshReductionPCH.h"
+#include "InstaLOD/InstaLODMeshPool.h"
+
+#include "InstaLOD/InstaLODAPI.h"
+
+#include "Misc/ScopeExit.h"
+#include "Misc/ScopeLock.h"
+
+namespace UEInstaLODMeshPoolHelper
+{
+	static inline void UpdateMaximum(std::atomic<int32>& Maximum, const int32 Value)
+	{
+		int32 Current = Maximum.load(std::memory_order_relaxed);
+		while (Value > Current && !Maximum.compare_exchange_weak(Current, Value, std::memory_order_relaxed))
+		{
+		}
+	}
+}
+
+FInstaLODMeshPool::FInstaLODMeshPool(InstaLOD::IInstaLOD *const InInstaLOD) :
+InstaLOD(InInstaLOD),
+RetainedBytes(0),
+InUseCount(0),
+InUseHighWaterMark(0)
+{
+	check(InstaLOD);
+}
+
+FInstaLODMeshPool::~FInstaLODMeshPool()
+{
+	Empty();
+}
+
+int64 FInstaLODMeshPool::EstimateMeshSizeInBytes(const InstaLOD::IInstaLODMesh *const Mesh)
+{
+	InstaLOD::uint64 Count = 0u;
+	int64 SizeInBytes = 0;
+
+	Mesh->GetVertexPositions(&Count);
+	SizeInBytes += Count * sizeof(InstaLOD::InstaVec3F);
+	Mesh->GetVertexOptimizerWeights(&Count);
+	SizeInBytes += Count * sizeof(float);
+
+	Mesh->GetWedgeIndices(&Count);
+	// NOTE: indices, normals, binormals and tangents
+	SizeInBytes += Count * (sizeof(InstaLOD::uint32) + sizeof(InstaLOD::InstaVec3F) * 3);
+
+	for (InstaLOD::uint64 ColorSetIndex=0u; ColorSetIndex<InstaLOD::INSTALOD_MAX_MESH_COLORSETS; ColorSetIndex++)
+	{
+		Mesh->GetWedgeColors(ColorSetIndex, &Count);
+		SizeInBytes += Count * sizeof(InstaLOD::InstaColorRGBAF32);
+	}
+
+	for (InstaLOD::uint64 TexCoordSetIndex=0u; TexCoordSetIndex<InstaLOD::INSTALOD_MAX_MESH_TEXCOORDS; TexCoordSetIndex++)
+	{
+		Mesh->GetWedgeTexCoords(TexCoordSetIndex, &Count);
+		SizeInBytes += Count * sizeof(InstaLOD::InstaVec2F);
+	}
+
+	Mesh->GetFaceMaterialIndices(&Count);
+	// NOTE: material indices, smoothing groups and submesh indices
+	SizeInBytes += Count * (sizeof(InstaLOD::InstaMaterialID) + sizeof(InstaLOD::uint32) * 2);
+
+	return SizeInBytes;
+}
+
+InstaLOD::IInstaLODMesh* FInstaLODMeshPool::Acquire()
+{
+	using namespace UEInstaLODMeshPoolHelper;
+
+	UpdateMaximum(InUseHighWaterMark, ++InUseCount);
+
+	if (InstaLOD::IInstaLODMesh *const Mesh = PopRetainedMesh())
+		return Mesh;
+
+	return InstaLOD->AllocMesh();
+}
+
+void FInstaLODMeshPool::Release(InstaLOD::IInstaLODMesh *const Mesh, const int64 MaxRetainedBytes)
+{
+	using namespace UEInstaLODMeshPoolHelper;
+
+	if (Mesh == nullptr)
+		return;
+
+	// NOTE: meshes that were not acquired from the pool can be released, the in use count must not become negative
+	int32 Current = InUseCount.load(std::memory_order_relaxed);
+	while (Current > 0 && !InUseCount.compare_exchange_weak(Current, Current - 1, std::memory_order_relaxed))
+	{
+	}
+
+	// NOTE: the operation that used the pool ends when its last mesh is released, the pool is trimmed at that point
+	const bool bIsLastMeshInUse = Current <= 1;
+	ON_SCOPE_EXIT
+	{
+		if (!bIsLastMeshInUse)
+			return;
+
+		if (MaxRetainedBytes > 0)
+		{
+			Trim();
+		}
+		else
+		{
+			Empty();
+		}
+	};
+
+	// NOTE: meshes with a non default winding order or format, e.g. deserialized meshes, are not reused as clearing keeps those properties
+	const bool bIsReusable = Mesh->GetMeshType() == InstaLOD::IInstaLODMeshBase::MeshTypeTriangle &&
+							 Mesh->GetFrontFaceWindingOrder() == InstaLOD::IInstaLODMeshBase::WindingOrderCounterClockwise &&
+							 Mesh->GetMeshFormatType() == InstaLOD::MeshFormat::OpenGL;
+
+	if (!bIsReusable || MaxRetainedBytes <= 0)
+	{
+		InstaLOD->DeallocMesh(Mesh);
+		return;
+	}
+
+	// NOTE: the budget is reserved before the mesh is pushed so that concurrent releases can't exceed it
+	const int64 SizeInBytes = EstimateMeshSizeInBytes(Mesh);
+	if (RetainedBytes.fetch_add(SizeInBytes) + SizeInBytes > MaxRetainedBytes)
+	{
+		RetainedBytes -= SizeInBytes;
+		InstaLOD->DeallocMesh(Mesh);
+		return;
+	}
+
+	Mesh->Clear();
+
+	FScopeLock ScopeLock(&RetainedMeshesLock);
+	RetainedMeshes.Add(FRetainedMesh{ Mesh, SizeInBytes });
+}
+
+void FInstaLODMeshPool::Trim()
+{
+	const int32 HighWaterMark = InUseHighWaterMark.exchange(InUseCount.load());
+	const int32 MaxRetainedCount = FMath::Max(HighWaterMark - InUseCount.load(), 0);
+
+	TArray<FRetainedMesh> TrimmedMeshes;
+	{
+		FScopeLock ScopeLock(&RetainedMeshesLock);
+
+		// NOTE: the most recently released meshes are kept, acquisitions pop from the back
+		const int32 TrimmedCount = FMath::Max(RetainedMeshes.Num() - MaxRetainedCount, 0);
+		TrimmedMeshes.Append(RetainedMeshes.GetData(), TrimmedCount);
+		RetainedMeshes.RemoveAt(0, TrimmedCount, /*bAllowShrinking*/false);
+	}
+
+	for (const FRetainedMesh& RetainedMesh : TrimmedMeshes)
+	{
+		RetainedBytes -= RetainedMesh.SizeInBytes;
+		InstaLOD->DeallocMesh(RetainedMesh.Mesh);
+	}
+}
+
+void FInstaLODMeshPool::Empty()
+{
+	TArray<FRetainedMesh> EmptiedMeshes;
+	{
+		FScopeLock ScopeLock(&RetainedMeshesLock);
+		EmptiedMeshes = MoveTemp(RetainedMeshes);
+		RetainedMeshes.Reset();
+	}
+
+	for (const FRetainedMesh& RetainedMesh : EmptiedMeshes)
+	{
+		RetainedBytes -= RetainedMesh.SizeInBytes;
+		InstaLOD->DeallocMesh(RetainedMesh.Mesh);
+	}
+}
+
+InstaLOD::IInstaLODMesh* FInstaLODMeshPool::PopRetainedMesh()
+{
+	FRetainedMesh RetainedMesh;
+	{
+		FScopeLock ScopeLock(&RetainedMeshesLock);
+
+		if (RetainedMeshes.Num() == 0)
+			return nullptr;
+
+		RetainedMesh = RetainedMeshes.Pop(/*bAllowShrinking*/false);
+	}
+
+	RetainedBytes -= RetainedMesh.SizeInBytes;
+	return RetainedMesh.Mesh;
+}
@@ -0,0 +1,88 @@
+/**
+ * InstaLODMeshPool.h (InstaLOD)
+ *
+ * Copyright 2016-2023 InstaLOD GmbH - All Rights Reserved.
+ *
+ * Unauthorized copying of this file, via any medium is strictly prohibited.
+ * This file and all it's contents are proprietary and confidential.
+ *
+ * @file InstaLODMeshPool.h
+ * @copyright 2016-2023 InstaLOD GmbH. All rights reserved.
+ * @section License
+ */
+
+#ifndef InstaLOD_InstaLODMeshPool_h
+#define InstaLOD_InstaLODMeshPool_h
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+
+#include <atomic>
+
+namespace InstaLOD
+{
+	class IInstaLOD;
+	class IInstaLODMesh;
+};
+
+/**
+ * Pool of InstaLOD meshes.
+ * Released meshes are cleared and retained so that subsequent acquisitions reuse the mesh instead of allocating
+ * a new mesh through the SDK. The amount of retained meshes is limited by a byte budget. Whenever the last mesh
+ * in use is released the retained meshes are trimmed to the peak amount of meshes used concurrently since the last trim.
+ * NOTE: the SDK doesn't specify whether IInstaLODMesh::Clear releases the attribute buffers, the budget therefore
+ * counts the estimated size of each mesh before it was cleared, which is an upper bound of the retained memory.
+ * NOTE: all methods are thread-safe.
+ */
+class FInstaLODMeshPool
+{
+public:
+	explicit FInstaLODMeshPool(InstaLOD::IInstaLOD *const InstaLOD);
+	~FInstaLODMeshPool();
+
+	/** Gets an empty mesh, either a retained mesh or a newly allocated mesh. */
+	InstaLOD::IInstaLODMesh* Acquire();
+
+	/**
+	 * Clears the mesh and retains it for reuse, or deallocates it if retaining it would exceed the budget.
+	 * Trims the pool if no other mesh is in use, all retained meshes are deallocated if retention is disabled.
+	 *
+	 * @param Mesh the mesh, can be a mesh that was not acquired from the pool.
+	 * @param MaxRetainedBytes the maximum size of all retained meshes, 0 disables retention.
+	 */
+	void Release(InstaLOD::IInstaLODMesh *const Mesh, const int64 MaxRetainedBytes);
+
+	/** Deallocates retained meshes exceeding the peak amount of concurrently used meshes since the last trim. */
+	void Trim();
+
+	/** Deallocates all retained meshes. */
+	void Empty();
+
+	/** Estimates the size of the mesh buffers from the size of its attribute arrays. */
+	static int64 EstimateMeshSizeInBytes(const InstaLOD::IInstaLODMesh *const Mesh);
+
+	/** Gets the estimated size of all retained meshes. */
+	int64 GetRetainedBytes() const { return RetainedBytes.load(std::memory_order_relaxed); }
+
+private:
+	struct FRetainedMesh
+	{
+		InstaLOD::IInstaLODMesh *Mesh = nullptr;
+		int64 SizeInBytes = 0;	/**< Estimated size of the mesh buffers before the mesh was cleared. */
+	};
+
+	/** Pops a retained mesh and updates the budget, returns nullptr if no mesh is retained. */
+	InstaLOD::IInstaLODMesh* PopRetainedMesh();
+
+	InstaLOD::IInstaLOD *const InstaLOD;
+
+	/** NOTE: the lock only guards the retained meshes, meshes are cleared and deallocated outside of the lock. */
+	FCriticalSection RetainedMeshesLock;
+	TArray<FRetainedMesh> RetainedMeshes;
+
+	std::atomic<int64> RetainedBytes;
+	std::atomic<int32> InUseCount;
+	std::atomic<int32> InUseHighWaterMark;	/**< Peak of InUseCount since the last trim. */
+};
+
+#endif
@@ -0,0 +1,631 @@
+/**
+ * InstaLODResultCache.cpp (InstaLOD)
+ *
+ * Copyright 2016-2023 InstaLOD GmbH - All Rights Reserved.
+ *
+ * Unauthorized copying of this file, via any medium is strictly prohibited.
+ * This file and all it's contents are proprietary and confidential.
+ *
+ * @file InstaLODResultCache.cpp
+ * @copyright 2016-2023 InstaLOD GmbH. All rights reserved.
+ * @section License
+ */
+
+#include "InstaLODMeshReductionPCH.h"
+#include "InstaLOD/InstaLODResultCache.h"
+
+#include "InstaLOD/InstaLODAPI.h"
+
+#include "Hash/xxhash.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "MaterialUtilities.h"
+#include "MeshDescription.h"
+#include "MeshMergeData.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Serialization/CustomVersion.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+namespace UEInstaLODResultCacheHelper
+{
+	/** Increment when the key or the entry layout changes to invalidate all existing entries. */
+	static constexpr uint32 kCacheFormatVersion = 4u;
+	static constexpr uint32 kCacheMetaMagic = 0x49434C52u; // 'ICLR'
+
+	/** NOTE: eviction removes entries until the cache is below this fraction of the size cap to avoid evicting on every store. */
+	static constexpr double kEvictionLowWaterMark = 0.9;
+
+	static constexpr uint32 kCacheProxyMagic = 0x49434C50u; // 'ICLP'
+
+	static const TCHAR *const kMeshExtension = TEXT(".mesh");
+	static const TCHAR *const kMetaExtension = TEXT(".meta");
+	static const TCHAR *const kProxyExtension = TEXT(".proxy");
+
+	/** The metadata stored alongside each cached mesh, the entry is valid once this has been written. */
+	struct FCacheEntryMeta
+	{
+		uint32 Magic;
+		uint32 FormatVersion;
+		FXxHash128 InputDigest;	/**< Digest of all inputs the key was computed from, verified on load. */
+		float MeshDeviation;
+	};
+
+	/** NOTE: entries are named after the low half of the input digest, the full digest is stored in the entry and verified on load. */
+	static FInstaLODResultCache::FKey MakeKey(const FXxHash128& InputDigest)
+	{
+		FInstaLODResultCache::FKey Key;
+		Key.Name = FString::Printf(TEXT("%016llx"), InputDigest.HashLow);
+		Key.InputDigest = InputDigest;
+		return Key;
+	}
+
+	template<typename T>
+	static inline void HashValue(FXxHash128Builder& Builder, const T& Value)
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be hashed.");
+		Builder.Update(&Value, sizeof(T));
+	}
+
+	/** Hashes the element count and contents of a mesh attribute, so that missing and empty attributes produce different keys. */
+	template<typename T>
+	static inline void HashAttribute(FXxHash128Builder& Builder, const T *const Data, const InstaLOD::uint64 Count)
+	{
+		HashValue(Builder, Count);
+
+		if (Data != nullptr && Count > 0u)
+		{
+			Builder.Update(Data, Count * sizeof(T));
+		}
+	}
+
+	/** NOTE: optimizer weights are only hashed if the optimizer uses them, so meshes shared by multiple LODs map to the same entries. */
+	static void HashMesh(FXxHash128Builder& Builder, const InstaLOD::IInstaLODMesh *const Mesh, const bool bHashOptimizerWeights)
+	{
+		InstaLOD::uint64 Count = 0u;
+
+		const InstaLOD::InstaVec3F *const VertexPositions = Mesh->GetVertexPositions(&Count);
+		HashAttribute(Builder, VertexPositions, Count);
+
+		if (bHashOptimizerWeights)
+		{
+			const float *const OptimizerWeights = Mesh->GetVertexOptimizerWeights(&Count);
+			HashAttribute(Builder, OptimizerWeights, Count);
+		}
+
+		const InstaLOD::uint32 *const WedgeIndices = Mesh->GetWedgeIndices(&Count);
+		HashAttribute(Builder, WedgeIndices, Count);
+		const InstaLOD::InstaVec3F *const WedgeNormals = Mesh->GetWedgeNormals(&Count);
+		HashAttribute(Builder, WedgeNormals, Count);
+		const InstaLOD::InstaVec3F *const WedgeBinormals = Mesh->GetWedgeBinormals(&Count);
+		HashAttribute(Builder, WedgeBinormals, Count);
+		const InstaLOD::InstaVec3F *const WedgeTangents = Mesh->GetWedgeTangents(&Count);
+		HashAttribute(Builder, WedgeTangents, Count);
+
+		for (InstaLOD::uint64 ColorSetIndex=0u; ColorSetIndex<InstaLOD::INSTALOD_MAX_MESH_COLORSETS; ColorSetIndex++)
+		{
+			const InstaLOD::InstaColorRGBAF32 *const WedgeColors = Mesh->GetWedgeColors(ColorSetIndex, &Count);
+			HashAttribute(Builder, WedgeColors, Count);
+		}
+
+		for (InstaLOD::uint64 TexCoordSetIndex=0u; TexCoordSetIndex<InstaLOD::INSTALOD_MAX_MESH_TEXCOORDS; TexCoordSetIndex++)
+		{
+			const InstaLOD::InstaVec2F *const WedgeTexCoords = Mesh->GetWedgeTexCoords(TexCoordSetIndex, &Count);
+			HashAttribute(Builder, WedgeTexCoords, Count);
+		}
+
+		const InstaLOD::InstaMaterialID *const FaceMaterialIndices = Mesh->GetFaceMaterialIndices(&Count);
+		HashAttribute(Builder, FaceMaterialIndices, Count);
+		const InstaLOD::uint32 *const FaceSmoothingGroups = Mesh->GetFaceSmoothingGroups(&Count);
+		HashAttribute(Builder, FaceSmoothingGroups, Count);
+	}
+
+	/** NOTE: fields are hashed individually as the settings structures contain padding. */
+	static void HashOptimizeSettings(FXxHash128Builder& Builder, const InstaLOD::OptimizeSettings& Settings)
+	{
+		HashValue(Builder, Settings.AlgorithmStrategy);
+		HashValue(Builder, Settings.AutomaticQuality);
+		HashValue(Builder, Settings.PercentTriangles);
+		HashValue(Builder, Settings.AbsoluteTriangles);
+		HashValue(Builder, Settings.MaxDeviation);
+		HashValue(Builder, Settings.WeldingThreshold);
+		HashValue(Builder, Settings.WeldingProtectDistinctUVShells);
+		HashValue(Builder, Settings.WeldingNormalAngleThreshold);
+		HashValue(Builder, Settings.HealTJunctionThreshold);
+		HashValue(Builder, Settings.ScreenSizeInPixels);
+		HashValue(Builder, Settings.OptimizerVertexWeights);
+		HashValue(Builder, Settings.OptimalPlacement);
+		HashValue(Builder, Settings.RecalculateNormals);
+		HashValue(Builder, Settings.HardAngleThreshold);
+		HashValue(Builder, Settings.WeightedNormals);
+		HashValue(Builder, Settings.NormalHealingMode);
+		HashValue(Builder, Settings.LockBoundaries);
+		HashValue(Builder, Settings.LockSplits);
+		HashValue(Builder, Settings.ProtectSplits);
+		HashValue(Builder, Settings.ProtectBoundaries);
+		HashValue(Builder, Settings.UnitScaleFactor);
+		HashValue(Builder, Settings.NormalizeMeshScale);
+
+		HashValue(Builder, Settings.SkeletonOptimize.LeafBoneWeldDistance);
+		HashValue(Builder, Settings.SkeletonOptimize.MaximumBoneDepth);
+		HashValue(Builder, Settings.SkeletonOptimize.MaximumBoneInfluencesPerVertex);
+		HashValue(Builder, Settings.SkeletonOptimize.MinimumBoneInfluenceThreshold);
+		HashAttribute(Builder, Settings.SkeletonOptimize.IgnoreJointIndices, Settings.SkeletonOptimize.IgnoreJointIndicesCount);
+
+		HashValue(Builder, Settings.BoundaryImportance);
+		HashValue(Builder, Settings.TextureImportance);
+		HashValue(Builder, Settings.ShadingImportance);
+		HashValue(Builder, Settings.SilhouetteImportance);
+		HashValue(Builder, Settings.SkinningImportance);
+		HashValue(Builder, Settings.Deterministic);
+	}
+
+	/** Feeds all serialized data into a hash, used for UE types without a stable memory layout. */
+	class FHashArchive : public FArchive
+	{
+	public:
+		explicit FHashArchive(FXxHash128Builder& InBuilder) : Builder(InBuilder)
+		{
+			SetIsSaving(true);
+			SetIsPersistent(true);
+		}
+
+		virtual void Serialize(void* Data, int64 Length) override
+		{
+			Builder.Update(Data, Length);
+		}
+
+		virtual FArchive& operator<<(FName& Value) override
+		{
+			FString Name = Value.ToString();
+			return *this << Name;
+		}
+
+		virtual FArchive& operator<<(UObject*& Value) override
+		{
+			FString PathName = Value != nullptr ? Value->GetPathName() : FString();
+			return *this << PathName;
+		}
+
+		virtual FString GetArchiveName() const override
+		{
+			return TEXT("UEInstaLODResultCacheHelper::FHashArchive");
+		}
+
+	private:
+		FXxHash128Builder& Builder;
+	};
+
+	/** Serializes the flattened material including all property pages. */
+	static void SerializeFlattenMaterial(FArchive& Ar, FFlattenMaterial& Material)
+	{
+		bool bTwoSided = Material.bTwoSided;
+		bool bDitheredLODTransition = Material.bDitheredLODTransition;
+		uint8 BlendMode = (uint8)Material.BlendMode;
+		Ar << bTwoSided << bDitheredLODTransition << BlendMode << Material.EmissiveScale;
+		Material.bTwoSided = bTwoSided;
+		Material.bDitheredLODTransition = bDitheredLODTransition;
+		Material.BlendMode = (EBlendMode)BlendMode;
+
+		for (int32 PropertyIndex=0; PropertyIndex<(int32)EFlattenMaterialProperties::NumFlattenMaterialProperties; PropertyIndex++)
+		{
+			const EFlattenMaterialProperties Property = (EFlattenMaterialProperties)PropertyIndex;
+			FIntPoint Size = Material.GetPropertySize(Property);
+			Ar << Size;
+			Material.SetPropertySize(Property, Size);
+			Ar << Material.GetPropertySamples(Property);
+		}
+	}
+}
+
+FInstaLODResultCache& FInstaLODResultCache::Get()
+{
+	static FInstaLODResultCache Instance;
+	return Instance;
+}
+
+FInstaLODResultCache::FInstaLODResultCache() :
+CacheSizeInBytes(-1),
+Hits(0u),
+Misses(0u),
+Stores(0u),
+Evictions(0u)
+{
+}
+
+FInstaLODResultCache::FKey FInstaLODResultCache::ComputeKey(InstaLOD::IInstaLOD *const InstaLOD, const InstaLOD::IInstaLODMesh *const InputMesh, const InstaLOD::OptimizeSettings& Settings)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLODResultCache::ComputeKey);
+	using namespace UEInstaLODResultCacheHelper;
+	check(InstaLOD);
+	check(InputMesh);
+
+	// NOTE: the skeleton is referenced by pointer and can't be part of a content-addressed key
+	check(Settings.Skeleton == nullptr);
+
+	FXxHash128Builder Builder;
+	HashValue(Builder, kCacheFormatVersion);
+
+	// results are invalidated whenever the SDK or the plugin changes
+	HashValue(Builder, InstaLOD->GetVersion());
+	const ANSICHAR *const BuildDate = InstaLOD->GetBuildDate();
+	Builder.Update(BuildDate, FCStringAnsi::Strlen(BuildDate));
+	Builder.Update(*InstaLODShared::Version, InstaLODShared::Version.Len() * sizeof(TCHAR));
+
+	HashOptimizeSettings(Builder, Settings);
+	HashMesh(Builder, InputMesh, Settings.OptimizerVertexWeights);
+
+	return MakeKey(Builder.Finalize());
+}
+
+FInstaLODResultCache::FKey FInstaLODResultCache::ComputeProxyKey(InstaLOD::IInstaLOD *const InstaLOD, const TArray<FMeshMergeData>& InData, const TArray<FFlattenMaterial>& InputMaterials,
+											  const FMeshProxySettings& ProxySettings, const bool bIsMergeOperation, const bool bIsDeterministic,
+											  const int32 ConstantPageTolerance, const InstaLOD::OptimizeSettings *const MergeOptimizeSettings)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLODResultCache::ComputeProxyKey);
+	using namespace UEInstaLODResultCacheHelper;
+	check(InstaLOD);
+
+	FXxHash128Builder Builder;
+	HashValue(Builder, kCacheFormatVersion);
+	HashValue(Builder, kCacheProxyMagic);
+
+	// results are invalidated whenever the SDK, the plugin or the engine changes
+	HashValue(Builder, InstaLOD->GetVersion());
+	const ANSICHAR *const BuildDate = InstaLOD->GetBuildDate();
+	Builder.Update(BuildDate, FCStringAnsi::Strlen(BuildDate));
+	Builder.Update(*InstaLODShared::Version, InstaLODShared::Version.Len() * sizeof(TCHAR));
+	HashValue(Builder, FEngineVersion::Current().GetChangelist());
+
+	HashValue(Builder, bIsMergeOperation);
+	HashValue(Builder, bIsDeterministic);
+	HashValue(Builder, ConstantPageTolerance);
+	HashValue(Builder, MergeOptimizeSettings != nullptr);
+
+	if (MergeOptimizeSettings != nullptr)
+	{
+		HashOptimizeSettings(Builder, *MergeOptimizeSettings);
+	}
+
+	FHashArchive HashArchive(Builder);
+	FMeshProxySettings::StaticStruct()->SerializeBin(HashArchive, const_cast<FMeshProxySettings*>(&ProxySettings));
+
+	// NOTE: the merge data is already in world space, therefore the hash covers the transforms of the source meshes
+	HashValue(Builder, InData.Num());
+	for (const FMeshMergeData& Data : InData)
+	{
+		HashArchive << *Data.RawMesh;
+		HashAttribute(Builder, Data.NewUVs.GetData(), (InstaLOD::uint64)Data.NewUVs.Num());
+	}
+
+	HashValue(Builder, InputMaterials.Num());
+	for (const FFlattenMaterial& Material : InputMaterials)
+	{
+		// NOTE: the hash archive is saving, the material is not modified
+		SerializeFlattenMaterial(HashArchive, const_cast<FFlattenMaterial&>(Material));
+	}
+
+	return MakeKey(Builder.Finalize());
+}
+
+bool FInstaLODResultCache::LoadProxy(const FKey& Key, FMeshDescription& OutProxyMesh, FFlattenMaterial& OutMaterial)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLODResultCache::LoadProxy);
+	using namespace UEInstaLODResultCacheHelper;
+
+	const FString ProxyPath = GetProxyPath(Key.Name);
+	TArray<uint8> EntryData;
+
+	if (!FFileHelper::LoadFileToArray(EntryData, *ProxyPath, FILEREAD_Silent))
+	{
+		Misses++;
+		return false;
+	}
+
+	FMemoryReader Reader(EntryData, /*bIsPersistent:*/ true);
+	uint32 Magic = 0u;
+	uint32 FormatVersion = 0u;
+	FXxHash128 InputDigest;
+	Reader << Magic << FormatVersion << InputDigest.HashLow << InputDigest.HashHigh;
+
+	// NOTE: entries stored for different inputs whose digest shares the entry name are misses
+	if (Reader.IsError() || Magic != kCacheProxyMagic || FormatVersion != kCacheFormatVersion || InputDigest != Key.InputDigest)
+	{
+		Misses++;
+		return false;
+	}
+
+	// NOTE: the custom versions of the entry are required to load the mesh description
+	FCustomVersionContainer CustomVersions;
+	CustomVersions.Serialize(Reader);
+	Reader.SetCustomVersions(CustomVersions);
+
+	FMeshDescription ProxyMesh;
+	FFlattenMaterial Material;
+	Reader << ProxyMesh;
+	SerializeFlattenMaterial(Reader, Material);
+
+	if (Reader.IsError())
+	{
+		Misses++;
+		return false;
+	}
+
+	// mark the entry as recently used
+	IFileManager::Get().SetTimeStamp(*ProxyPath, FDateTime::UtcNow());
+
+	Hits++;
+	OutProxyMesh = MoveTemp(ProxyMesh);
+	OutMaterial = MoveTemp(Material);
+	return true;
+}
+
+void FInstaLODResultCache::StoreProxy(const FMeshDescription& ProxyMesh, const FFlattenMaterial& Material, const FKey& Key, const int64 MaxSizeInBytes)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLODResultCache::StoreProxy);
+	using namespace UEInstaLODResultCacheHelper;
+
+	// NOTE: the writers are saving, the proxy is not modified
+	TArray<uint8> Payload;
+	FMemoryWriter PayloadWriter(Payload, /*bIsPersistent:*/ true);
+	PayloadWriter << const_cast<FMeshDescription&>(ProxyMesh);
+	SerializeFlattenMaterial(PayloadWriter, const_cast<FFlattenMaterial&>(Material));
+
+	TArray<uint8> EntryData;
+	FMemoryWriter EntryWriter(EntryData, /*bIsPersistent:*/ true);
+	uint32 Magic = kCacheProxyMagic;
+	uint32 FormatVersion = kCacheFormatVersion;
+	FXxHash128 InputDigest = Key.InputDigest;
+	EntryWriter << Magic << FormatVersion << InputDigest.HashLow << InputDigest.HashHigh;
+	FCustomVersionContainer CustomVersions = PayloadWriter.GetCustomVersions();
+	CustomVersions.Serialize(EntryWriter);
+	EntryWriter.Serialize(Payload.GetData(), Payload.Num());
+
+	IFileManager& FileManager = IFileManager::Get();
+	FileManager.MakeDirectory(*GetCacheDirectory(), /*Tree:*/ true);
+
+	// NOTE: the entry is written to a unique temporary file outside of the lock and moved into place afterwards
+	const FString ProxyPath = GetProxyPath(Key.Name);
+	const FString TempProxyPath = FString::Printf(TEXT("%s.%s.tmp"), *ProxyPath, *FGuid::NewGuid().ToString());
+
+	if (!FFileHelper::SaveArrayToFile(EntryData, *TempProxyPath))
+	{
+		UE_LOG(LogInstaLOD, Warning, TEXT("Failed to write proxy cache entry '%s'."), *Key.Name);
+		FileManager.Delete(*TempProxyPath, false, false, true);
+		return;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+
+	const int64 PreviousEntrySize = FMath::Max<int64>(FileManager.FileSize(*ProxyPath), 0);
+
+	if (!FileManager.Move(*ProxyPath, *TempProxyPath, /*Replace:*/ true))
+	{
+		UE_LOG(LogInstaLOD, Warning, TEXT("Failed to write proxy cache entry '%s'."), *Key.Name);
+		FileManager.Delete(*TempProxyPath, false, false, true);
+		return;
+	}
+
+	Stores++;
+
+	if (CacheSizeInBytes >= 0)
+	{
+		CacheSizeInBytes += EntryData.Num() - PreviousEntrySize;
+	}
+
+	if (CacheSizeInBytes < 0 || CacheSizeInBytes > MaxSizeInBytes)
+	{
+		EvictLeastRecentlyUsed(MaxSizeInBytes);
+	}
+}
+
+InstaLOD::IInstaLODMesh* FInstaLODResultCache::Load(InstaLOD::IInstaLOD *const InstaLOD, const FKey& Key, float& OutMeshDeviation)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLODResultCache::Load);
+	using namespace UEInstaLODResultCacheHelper;
+	check(InstaLOD);
+
+	const FString MetaPath = GetMetaPath(Key.Name);
+	TArray<uint8> MetaData;
+
+	// NOTE: a missing or invalid meta file is a miss, the entry may not have been fully written or is being evicted
+	if (!FFileHelper::LoadFileToArray(MetaData, *MetaPath, FILEREAD_Silent) || MetaData.Num() != sizeof(FCacheEntryMeta))
+	{
+		Misses++;
+		return nullptr;
+	}
+
+	FCacheEntryMeta Meta;
+	FMemory::Memcpy(&Meta, MetaData.GetData(), sizeof(FCacheEntryMeta));
+
+	if (Meta.Magic != kCacheMetaMagic || Meta.FormatVersion != kCacheFormatVersion || Meta.InputDigest != Key.InputDigest)
+	{
+		Misses++;
+		return nullptr;
+	}
+
+	InstaLOD::IInstaLODMeshBase *const MeshBase = InstaLOD->DeserializeMesh(TCHAR_TO_UTF8(*GetMeshPath(Key.Name)), 0u);
+
+	if (MeshBase == nullptr)
+	{
+		Misses++;
+		return nullptr;
+	}
+
+	if (MeshBase->GetMeshType() != InstaLOD::IInstaLODMeshBase::MeshTypeTriangle)
+	{
+		InstaLOD->DeallocPolygonMesh(static_cast<InstaLOD::IInstaLODPolygonMesh*>(MeshBase));
+		Misses++;
+		return nullptr;
+	}
+
+	// mark the entry as recently used
+	IFileManager::Get().SetTimeStamp(*MetaPath, FDateTime::UtcNow());
+
+	Hits++;
+	OutMeshDeviation = Meta.MeshDeviation;
+	return static_cast<InstaLOD::IInstaLODMesh*>(MeshBase);
+}
+
+void FInstaLODResultCache::Store(const InstaLOD::IInstaLODMesh *const Mesh, const FKey& Key, const float MeshDeviation, const int64 MaxSizeInBytes)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLODResultCache::Store);
+	using namespace UEInstaLODResultCacheHelper;
+	check(Mesh);
+
+	IFileManager& FileManager = IFileManager::Get();
+	FileManager.MakeDirectory(*GetCacheDirectory(), /*Tree:*/ true);
+
+	// NOTE: the mesh is serialized to a unique temporary file outside of the lock and moved into place afterwards
+	const FString MeshPath = GetMeshPath(Key.Name);
+	const FString TempMeshPath = FString::Printf(TEXT("%s.%s.tmp"), *MeshPath, *FGuid::NewGuid().ToString());
+
+	if (!Mesh->Serialize(TCHAR_TO_UTF8(*TempMeshPath), nullptr))
+	{
+		UE_LOG(LogInstaLOD, Warning, TEXT("Failed to write LOD cache entry '%s'."), *Key.Name);
+		FileManager.Delete(*TempMeshPath, false, false, true);
+		return;
+	}
+
+	// NOTE: the meta data is written as is, clear the padding to keep entries byte-identical
+	FCacheEntryMeta Meta;
+	FMemory::Memzero(&Meta, sizeof(FCacheEntryMeta));
+	Meta.Magic = kCacheMetaMagic;
+	Meta.FormatVersion = kCacheFormatVersion;
+	Meta.InputDigest = Key.InputDigest;
+	Meta.MeshDeviation = MeshDeviation;
+
+	FScopeLock ScopeLock(&Lock);
+
+	const int64 PreviousEntrySize = FMath::Max<int64>(FileManager.FileSize(*MeshPath), 0);
+
+	if (!FileManager.Move(*MeshPath, *TempMeshPath, /*Replace:*/ true) ||
+		!FFileHelper::SaveArrayToFile(TArrayView<const uint8>((const uint8*)&Meta, sizeof(FCacheEntryMeta)), *GetMetaPath(Key.Name)))
+	{
+		UE_LOG(LogInstaLOD, Warning, TEXT("Failed to write LOD cache entry '%s'."), *Key.Name);
+		FileManager.Delete(*TempMeshPath, false, false, true);
+		FileManager.Delete(*MeshPath, false, false, true);
+		return;
+	}
+
+	Stores++;
+
+	if (CacheSizeInBytes >= 0)
+	{
+		CacheSizeInBytes += FMath::Max<int64>(FileManager.FileSize(*MeshPath), 0) - PreviousEntrySize;
+	}
+
+	if (CacheSizeInBytes < 0 || CacheSizeInBytes > MaxSizeInBytes)
+	{
+		EvictLeastRecentlyUsed(MaxSizeInBytes);
+	}
+}
+
+void FInstaLODResultCache::EvictLeastRecentlyUsed(const int64 MaxSizeInBytes)
+{
+	using namespace UEInstaLODResultCacheHelper;
+
+	struct FCacheEntry
+	{
+		FDateTime LastAccessTime = FDateTime::MinValue();
+		int64 SizeInBytes = 0;
+	};
+
+	// collect all entries, the meta file timestamp tracks the last access
+	TMap<FString, FCacheEntry> Entries;
+	int64 TotalSizeInBytes = 0;
+
+	IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+	PlatformFile.IterateDirectoryStat(*GetCacheDirectory(), [&Entries, &TotalSizeInBytes](const TCHAR* FilenameOrDirectory, const FFileStatData& StatData) -> bool
+	{
+		if (StatData.bIsDirectory)
+			return true;
+
+		const FString Filename = FPaths::GetCleanFilename(FilenameOrDirectory);
+		// NOTE: proxy entries consist of a single file that also tracks the last access
+		const bool bIsMeta = Filename.EndsWith(kMetaExtension) || Filename.EndsWith(kProxyExtension);
+
+		if (!bIsMeta && !Filename.EndsWith(kMeshExtension))
+			return true;
+
+		FCacheEntry& Entry = Entries.FindOrAdd(FPaths::GetBaseFilename(Filename));
+		Entry.SizeInBytes += StatData.FileSize;
+
+		if (bIsMeta || Entry.LastAccessTime == FDateTime::MinValue())
+		{
+			Entry.LastAccessTime = StatData.ModificationTime;
+		}
+		TotalSizeInBytes += StatData.FileSize;
+		return true;
+	});
+
+	CacheSizeInBytes = TotalSizeInBytes;
+
+	if (CacheSizeInBytes <= MaxSizeInBytes)
+		return;
+
+	Entries.ValueSort([](const FCacheEntry& A, const FCacheEntry& B)
+	{
+		return A.LastAccessTime < B.LastAccessTime;
+	});
+
+	const int64 TargetSizeInBytes = (int64)(MaxSizeInBytes * kEvictionLowWaterMark);
+	IFileManager& FileManager = IFileManager::Get();
+
+	for (const TPair<FString, FCacheEntry>& Entry : Entries)
+	{
+		if (CacheSizeInBytes <= TargetSizeInBytes)
+			break;
+
+		// NOTE: the meta file is removed first, so that concurrent lookups treat the entry as a miss
+		FileManager.Delete(*GetMetaPath(Entry.Key), false, false, true);
+		FileManager.Delete(*GetMeshPath(Entry.Key), false, false, true);
+		FileManager.Delete(*GetProxyPath(Entry.Key), false, false, true);
+		CacheSizeInBytes -= Entry.Value.SizeInBytes;
+		Evictions++;
+	}
+
+	UE_LOG(LogInstaLOD, Verbose, TEXT("Evicted LOD cache entries, cache size is now %lld bytes."), CacheSizeInBytes);
+}
+
+FInstaLODResultCache::FStats FInstaLODResultCache::GetStats() const
+{
+	FStats Stats;
+	Stats.Hits = Hits.load();
+	Stats.Misses = Misses.load();
+	Stats.Stores = Stores.load();
+	Stats.Evictions = Evictions.load();
+	return Stats;
+}
+
+void FInstaLODResultCache::ResetStats()
+{
+	Hits = 0u;
+	Misses = 0u;
+	Stores = 0u;
+	Evictions = 0u;
+}
+
+FString FInstaLODResultCache::GetCacheDirectory() const
+{
+	return FPaths::ProjectSavedDir() / TEXT("InstaLOD") / TEXT("LODCache");
+}
+
+FString FInstaLODResultCache::GetMeshPath(const FString& Key) const
+{
+	return GetCacheDirectory() / Key + UEInstaLODResultCacheHelper::kMeshExtension;
+}
+
+FString FInstaLODResultCache::GetMetaPath(const FString& Key) const
+{
+	return GetCacheDirectory() / Key + UEInstaLODResultCacheHelper::kMetaExtension;
+}
+
+FString FInstaLODResultCache::GetProxyPath(const FString& Key) const
+{
+	return GetCacheDirectory() / Key + UEInstaLODResultCacheHelper::kProxyExtension;
+}
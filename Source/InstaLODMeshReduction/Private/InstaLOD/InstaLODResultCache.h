@@ -0,0 +1,158 @@
+/**
+ * InstaLODResultCache.h (InstaLOD)
+ *
+ * Copyright 2016-2023 InstaLOD GmbH - All Rights Reserved.
+ *
+ * Unauthorized copying of this file, via any medium is strictly prohibited.
+ * This file and all it's contents are proprietary and confidential.
+ *
+ * @file InstaLODResultCache.h
+ * @copyright 2016-2023 InstaLOD GmbH. All rights reserved.
+ * @section License
+ */
+
+#ifndef InstaLOD_InstaLODResultCache_h
+#define InstaLOD_InstaLODResultCache_h
+
+#include "CoreMinimal.h"
+#include "HAL/CriticalSection.h"
+#include "Hash/xxhash.h"
+
+#include <atomic>
+
+namespace InstaLOD
+{
+	class IInstaLOD;
+	class IInstaLODMesh;
+	struct OptimizeSettings;
+};
+
+struct FFlattenMaterial;
+struct FMeshDescription;
+struct FMeshMergeData;
+struct FMeshProxySettings;
+
+/**
+ * Local content-addressed cache of optimized meshes and HLOD proxies.
+ * Mesh entries are keyed by a 128-bit hash of the InstaLOD input mesh buffers and the resolved optimize settings,
+ * the optimized mesh is stored with IInstaLODMesh::Serialize in the project's saved directory.
+ * Proxy entries are keyed by a 128-bit hash of the merge data, the flattened input materials and the proxy settings,
+ * the proxy mesh and material are stored as they are passed to the proxy completion delegate.
+ * The least recently used entries are evicted once the cache exceeds its size cap.
+ * NOTE: all methods are thread-safe.
+ */
+class FInstaLODResultCache
+{
+public:
+	/** Cache statistics since startup or the last reset. */
+	struct FStats
+	{
+		uint64 Hits = 0u;		/**< Amount of optimized meshes and proxies loaded from the cache. */
+		uint64 Misses = 0u;		/**< Amount of lookups without a valid cache entry. */
+		uint64 Stores = 0u;		/**< Amount of optimized meshes and proxies written to the cache. */
+		uint64 Evictions = 0u;	/**< Amount of entries removed to stay within the size cap. */
+	};
+
+	/** Identifies a cache entry. */
+	struct FKey
+	{
+		FString Name;				/**< The name of the entry files in the cache directory. */
+		FXxHash128 InputDigest;		/**< Digest of all inputs, stored in the entry and compared on load so that name collisions are misses. */
+	};
+
+	static FInstaLODResultCache& Get();
+
+	/**
+	 * Computes the cache key for the optimization of the input mesh with the specified settings.
+	 *
+	 * @param InstaLOD the InstaLOD API, its version is part of the key.
+	 * @param InputMesh the input mesh as it is passed to the optimizer.
+	 * @param Settings the resolved optimize settings.
+	 * @return the cache key.
+	 */
+	static FKey ComputeKey(InstaLOD::IInstaLOD *const InstaLOD, const InstaLOD::IInstaLODMesh *const InputMesh, const InstaLOD::OptimizeSettings& Settings);
+
+	/**
+	 * Loads a cached optimized mesh.
+	 * NOTE: a successfully loaded mesh must be deallocated by the caller.
+	 *
+	 * @param InstaLOD the InstaLOD API.
+	 * @param Key the cache key.
+	 * @param OutMeshDeviation the mesh deviation reported by the optimizer for the cached mesh.
+	 * @return the cached mesh or nullptr on a cache miss, entries stored for a different input digest are misses.
+	 */
+	InstaLOD::IInstaLODMesh* Load(InstaLOD::IInstaLOD *const InstaLOD, const FKey& Key, float& OutMeshDeviation);
+
+	/**
+	 * Stores an optimized mesh and evicts the least recently used entries if the cache exceeds the size cap.
+	 *
+	 * @param Mesh the optimized mesh.
+	 * @param Key the cache key.
+	 * @param MeshDeviation the mesh deviation reported by the optimizer.
+	 * @param MaxSizeInBytes the size cap of the cache.
+	 */
+	void Store(const InstaLOD::IInstaLODMesh *const Mesh, const FKey& Key, const float MeshDeviation, const int64 MaxSizeInBytes);
+
+	/**
+	 * Computes the cache key for the proxy of the merge data.
+	 *
+	 * @param InstaLOD the InstaLOD API, its version is part of the key.
+	 * @param InData the merge data passed to ProxyLOD.
+	 * @param InputMaterials the flattened input materials passed to ProxyLOD.
+	 * @param ProxySettings the proxy settings.
+	 * @param bIsMergeOperation whether the proxy is built with mesh merging instead of remeshing.
+	 * @param bIsDeterministic whether the proxy operation is deterministic.
+	 * @param ConstantPageTolerance the tolerance used to collapse constant pages of the proxy material.
+	 * @param MergeOptimizeSettings (optional) the resolved settings used to optimize the merged mesh.
+	 * @return the cache key.
+	 */
+	static FKey ComputeProxyKey(InstaLOD::IInstaLOD *const InstaLOD, const TArray<FMeshMergeData>& InData, const TArray<FFlattenMaterial>& InputMaterials,
+								   const FMeshProxySettings& ProxySettings, const bool bIsMergeOperation, const bool bIsDeterministic,
+								   const int32 ConstantPageTolerance, const InstaLOD::OptimizeSettings *const MergeOptimizeSettings);
+
+	/**
+	 * Loads a cached proxy.
+	 *
+	 * @param Key the cache key.
+	 * @param OutProxyMesh the cached proxy mesh.
+	 * @param OutMaterial the cached proxy material.
+	 * @return true on a cache hit, entries stored for a different input digest are misses.
+	 */
+	bool LoadProxy(const FKey& Key, FMeshDescription& OutProxyMesh, FFlattenMaterial& OutMaterial);
+
+	/**
+	 * Stores a proxy and evicts the least recently used entries if the cache exceeds the size cap.
+	 *
+	 * @param ProxyMesh the proxy mesh.
+	 * @param Material the proxy material.
+	 * @param Key the cache key.
+	 * @param MaxSizeInBytes the size cap of the cache.
+	 */
+	void StoreProxy(const FMeshDescription& ProxyMesh, const FFlattenMaterial& Material, const FKey& Key, const int64 MaxSizeInBytes);
+
+	FStats GetStats() const;
+	void ResetStats();
+
+	/** Gets the directory that contains the cache entries. */
+	FString GetCacheDirectory() const;
+
+private:
+	FInstaLODResultCache();
+
+	FString GetMeshPath(const FString& Key) const;
+	FString GetMetaPath(const FString& Key) const;
+	FString GetProxyPath(const FString& Key) const;
+
+	/** Removes the least recently used entries until the cache is within the size cap. NOTE: requires the lock to be held. */
+	void EvictLeastRecentlyUsed(const int64 MaxSizeInBytes);
+
+	FCriticalSection Lock;
+	int64 CacheSizeInBytes;	/**< Cached size of all entries, -1 until the cache directory has been scanned. */
+
+	std::atomic<uint64> Hits;
+	std::atomic<uint64> Misses;
+	std::atomic<uint64> Stores;
+	std::atomic<uint64> Evictions;
+};
+
+#endif
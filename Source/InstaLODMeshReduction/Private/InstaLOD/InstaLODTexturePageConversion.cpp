@@ -0,0 +1,393 @@
+/**
+ * InstaLODTexturePageConversion.cpp (InstaLOD)
+ *
+ * Copyright 2016-2023 InstaLOD GmbH - All Rights Reserved.
+ *
+ * Unauthorized copying of this file, via any medium is strictly prohibited.
+ * This file and all it's contents are proprietary and confidential.
+ *
+ * @file InstaLODTexturePageConversion.cpp
+ * @copyright 2016-2023 InstaLOD GmbH. All rights reserved.
+ * @section License
+ */
+
+#include "InstaLODMeshReductionPCH.h"
+#include "InstaLOD/InstaLODTexturePageConversion.h"
+
+#include "InstaLOD/InstaLODAPI.h"
+
+#include "Async/ParallelFor.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/VectorRegister.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+#include <atomic>
+
+namespace UEInstaLODTexturePageConversionHelper
+{
+	/** The amount of texels processed by a single task when converting texture pages in parallel. */
+	static constexpr int32 kTexelChunkSize = 64 * 1024;
+
+	static bool IsParallelConversionDisabled()
+	{
+		static const TConsoleVariableData<int32>* const ParallelConversionCVar = IConsoleManager::Get().FindTConsoleVariableDataInt(TEXT("InstaLOD.ParallelConversion"));
+		return ParallelConversionCVar != nullptr && ParallelConversionCVar->GetValueOnAnyThread() == 0;
+	}
+
+	/** The per-channel value range of a block of texels. */
+	struct FTexelRange
+	{
+		uint8 Min[4] = { MAX_uint8, MAX_uint8, MAX_uint8, MAX_uint8 };
+		uint8 Max[4] = { 0u, 0u, 0u, 0u };
+
+		void Add(const FTexelRange& Other)
+		{
+			for (int32 Channel=0; Channel<4; Channel++)
+			{
+				Min[Channel] = FMath::Min(Min[Channel], Other.Min[Channel]);
+				Max[Channel] = FMath::Max(Max[Channel], Other.Max[Channel]);
+			}
+		}
+
+		bool IsWithinTolerance(const int32 Tolerance) const
+		{
+			for (int32 Channel=0; Channel<4; Channel++)
+			{
+				if ((int32)Max[Channel] - (int32)Min[Channel] > Tolerance)
+					return false;
+			}
+			return true;
+		}
+	};
+
+	/** Gets the factor that normalizes a component to [0, 1]. */
+	template<typename ComponentType>
+	static constexpr float GetComponentScale()
+	{
+		return TIsSame<ComponentType, uint8>::Value ? 1.0f / 255.0f : TIsSame<ComponentType, uint16>::Value ? 1.0f / 65535.0f : 1.0f;
+	}
+
+	/** Loads a texel as normalized RGBA, luminance is replicated to RGB and pages without alpha are opaque. */
+	template<typename ComponentType, int32 ChannelCount>
+	static FORCEINLINE VectorRegister4Float LoadTexel(const ComponentType *const Texel)
+	{
+		static_assert(ChannelCount >= 1 && ChannelCount <= 4, "Unsupported channel count.");
+		constexpr float Scale = GetComponentScale<ComponentType>();
+
+		if constexpr (ChannelCount == 1)
+		{
+			const float Luminance = (float)Texel[0] * Scale;
+			return MakeVectorRegisterFloat(Luminance, Luminance, Luminance, 1.0f);
+		}
+		else if constexpr (ChannelCount == 2)
+		{
+			const float Luminance = (float)Texel[0] * Scale;
+			return MakeVectorRegisterFloat(Luminance, Luminance, Luminance, (float)Texel[1] * Scale);
+		}
+		else if constexpr (ChannelCount == 3)
+		{
+			return MakeVectorRegisterFloat((float)Texel[0] * Scale, (float)Texel[1] * Scale, (float)Texel[2] * Scale, 1.0f);
+		}
+		else if constexpr (TIsSame<ComponentType, float>::Value)
+		{
+			return VectorLoad(Texel);
+		}
+		else
+		{
+			return VectorMultiply(MakeVectorRegisterFloat((float)Texel[0], (float)Texel[1], (float)Texel[2], (float)Texel[3]), VectorSetFloat1(Scale));
+		}
+	}
+
+	/** Converts a row of texels to FColor, this is identical to FLinearColor::ToFColor without sRGB conversion. */
+	template<typename ComponentType, int32 ChannelCount>
+	static void ConvertRow(FColor* RESTRICT OutRow, const ComponentType* RESTRICT InRow, const uint32 Width)
+	{
+		if constexpr (TIsSame<ComponentType, uint8>::Value && ChannelCount == 4)
+		{
+			// NOTE: 8-bit components are exact, only R and B of the packed little endian texels have to be swapped
+			static_assert(PLATFORM_LITTLE_ENDIAN, "The texel swizzle requires a little endian platform.");
+			const uint32* RESTRICT InTexels = (const uint32*)InRow;
+			uint32* RESTRICT OutTexels = (uint32*)OutRow;
+
+			for (uint32 X=0; X<Width; X++)
+			{
+				const uint32 Texel = InTexels[X];
+				OutTexels[X] = (Texel & 0xFF00FF00u) | ((Texel >> 16) & 0xFFu) | ((Texel & 0xFFu) << 16);
+			}
+		}
+		else
+		{
+			const VectorRegister4Float Quantize = VectorSetFloat1(255.999f);
+
+			for (uint32 X=0; X<Width; X++)
+			{
+				// NOTE: the operand order of the clamp matches FMath::Clamp for NaN values on SSE
+				const VectorRegister4Float RGBA = VectorMin(VectorMax(VectorZeroFloat(), LoadTexel<ComponentType, ChannelCount>(InRow + X * ChannelCount)), VectorOneFloat());
+				VectorStoreByte4(VectorSwizzle(VectorMultiply(RGBA, Quantize), 2, 1, 0, 3), OutRow + X);
+			}
+		}
+	}
+
+	/** Converts a row of texels to FFloat16Color. */
+	template<typename ComponentType, int32 ChannelCount>
+	static void ConvertRow(FFloat16Color* RESTRICT OutRow, const ComponentType* RESTRICT InRow, const uint32 Width)
+	{
+		for (uint32 X=0; X<Width; X++)
+		{
+			alignas(16) float RGBA[4];
+			VectorStoreAligned(LoadTexel<ComponentType, ChannelCount>(InRow + X * ChannelCount), RGBA);
+
+			OutRow[X].R = FFloat16(RGBA[0]);
+			OutRow[X].G = FFloat16(RGBA[1]);
+			OutRow[X].B = FFloat16(RGBA[2]);
+			OutRow[X].A = FFloat16(RGBA[3]);
+		}
+	}
+
+	/**
+	 * Copies a row of 16-bit texels and expands or drops channels, components are never converted.
+	 * Luminance is replicated to RGB and pages without alpha are opaque.
+	 */
+	template<int32 ChannelCount, int32 OutChannelCount>
+	static void CopyRow16(uint16* RESTRICT OutRow, const uint16* RESTRICT InRow, const uint32 Width)
+	{
+		static_assert(OutChannelCount == 1 || OutChannelCount == 4, "Unsupported output channel count.");
+
+		if constexpr (ChannelCount == OutChannelCount)
+		{
+			FMemory::Memcpy(OutRow, InRow, (SIZE_T)Width * ChannelCount * sizeof(uint16));
+		}
+		else
+		{
+			for (uint32 X=0; X<Width; X++)
+			{
+				const uint16 *const Texel = InRow + X * ChannelCount;
+				uint16 *const OutTexel = OutRow + X * OutChannelCount;
+
+				if constexpr (OutChannelCount == 1)
+				{
+					OutTexel[0] = Texel[0];
+				}
+				else if constexpr (ChannelCount <= 2)
+				{
+					OutTexel[0] = OutTexel[1] = OutTexel[2] = Texel[0];
+					OutTexel[3] = ChannelCount == 2 ? Texel[ChannelCount - 1] : MAX_uint16;
+				}
+				else
+				{
+					OutTexel[0] = Texel[0];
+					OutTexel[1] = Texel[1];
+					OutTexel[2] = Texel[2];
+					OutTexel[3] = MAX_uint16;
+				}
+			}
+		}
+	}
+
+	/** Invokes the row function for every row of the page, blocks of rows are processed in parallel. */
+	template<typename RowFunctionType>
+	static void ParallelForRows(const uint32 Width, const uint32 Height, const bool bFlipY, const RowFunctionType& RowFunction)
+	{
+		const int32 RowsPerBlock = FMath::Max(1, kTexelChunkSize / (int32)FMath::Max(Width, 1u));
+
+		ParallelFor(FMath::DivideAndRoundUp((int32)Height, RowsPerBlock), [&](const int32 BlockIndex)
+		{
+			const uint32 FirstRow = (uint32)(BlockIndex * RowsPerBlock);
+			const uint32 EndRow = FMath::Min(FirstRow + (uint32)RowsPerBlock, Height);
+
+			for (uint32 Y=FirstRow; Y<EndRow; Y++)
+			{
+				RowFunction(Y, bFlipY ? Height - (Y+1u) : Y);
+			}
+		}, IsParallelConversionDisabled());
+	}
+
+	template<typename ComponentType, int32 ChannelCount, typename TexelType>
+	static void ConvertRows(const InstaLOD::IInstaLODTexturePage *const TexturePage, TexelType *const OutTexels, const bool bFlipY)
+	{
+		const uint32 Width = TexturePage->GetWidth();
+		const ComponentType *const InData = (const ComponentType*)TexturePage->GetData(nullptr);
+		const SIZE_T InRowStride = (SIZE_T)Width * ChannelCount;
+
+		ParallelForRows(Width, TexturePage->GetHeight(), bFlipY, [&](const uint32 Y, const uint32 SourceY)
+		{
+			ConvertRow<ComponentType, ChannelCount>(OutTexels + (SIZE_T)Y * Width, InData + (SIZE_T)SourceY * InRowStride, Width);
+		});
+	}
+
+	template<int32 ChannelCount, int32 OutChannelCount>
+	static void CopyRows16(const InstaLOD::IInstaLODTexturePage *const TexturePage, uint16 *const OutComponents, const bool bFlipY)
+	{
+		const uint32 Width = TexturePage->GetWidth();
+		const uint16 *const InData = (const uint16*)TexturePage->GetData(nullptr);
+
+		ParallelForRows(Width, TexturePage->GetHeight(), bFlipY, [&](const uint32 Y, const uint32 SourceY)
+		{
+			CopyRow16<ChannelCount, OutChannelCount>(OutComponents + (SIZE_T)Y * Width * OutChannelCount, InData + (SIZE_T)SourceY * Width * ChannelCount, Width);
+		});
+	}
+
+	template<int32 OutChannelCount>
+	static bool CopyPage16(const InstaLOD::IInstaLODTexturePage *const TexturePage, TArray<uint16>& OutComponents, const bool bFlipY)
+	{
+		check(TexturePage);
+
+		if (TexturePage->GetComponentType() != InstaLOD::IInstaLODTexturePage::ComponentTypeUInt16)
+			return false;
+
+		const InstaLOD::IInstaLODTexturePage::PixelType PixelType = TexturePage->GetPixelType();
+		OutComponents.SetNumUninitialized(TexturePage->GetWidth() * TexturePage->GetHeight() * OutChannelCount);
+
+		if (OutComponents.Num() == 0)
+			return true;
+
+		switch (PixelType)
+		{
+			case InstaLOD::IInstaLODTexturePage::PixelTypeLuminance:
+				CopyRows16<1, OutChannelCount>(TexturePage, OutComponents.GetData(), bFlipY);
+				return true;
+			case InstaLOD::IInstaLODTexturePage::PixelTypeLuminanceAlpha:
+				CopyRows16<2, OutChannelCount>(TexturePage, OutComponents.GetData(), bFlipY);
+				return true;
+			case InstaLOD::IInstaLODTexturePage::PixelTypeRGB:
+				CopyRows16<3, OutChannelCount>(TexturePage, OutComponents.GetData(), bFlipY);
+				return true;
+			case InstaLOD::IInstaLODTexturePage::PixelTypeRGBA:
+				CopyRows16<4, OutChannelCount>(TexturePage, OutComponents.GetData(), bFlipY);
+				return true;
+		}
+		return false;
+	}
+
+	template<typename ComponentType, typename TexelType>
+	static bool ConvertPixelType(const InstaLOD::IInstaLODTexturePage *const TexturePage, TexelType *const OutTexels, const bool bFlipY)
+	{
+		switch (TexturePage->GetPixelType())
+		{
+			case InstaLOD::IInstaLODTexturePage::PixelTypeLuminance:
+				ConvertRows<ComponentType, 1>(TexturePage, OutTexels, bFlipY);
+				return true;
+			case InstaLOD::IInstaLODTexturePage::PixelTypeLuminanceAlpha:
+				ConvertRows<ComponentType, 2>(TexturePage, OutTexels, bFlipY);
+				return true;
+			case InstaLOD::IInstaLODTexturePage::PixelTypeRGB:
+				ConvertRows<ComponentType, 3>(TexturePage, OutTexels, bFlipY);
+				return true;
+			case InstaLOD::IInstaLODTexturePage::PixelTypeRGBA:
+				ConvertRows<ComponentType, 4>(TexturePage, OutTexels, bFlipY);
+				return true;
+		}
+		return false;
+	}
+
+	template<typename TexelType>
+	static bool ConvertPage(const InstaLOD::IInstaLODTexturePage *const TexturePage, TArray<TexelType>& OutTexels, const bool bFlipY)
+	{
+		check(TexturePage);
+		OutTexels.SetNumUninitialized(TexturePage->GetWidth() * TexturePage->GetHeight());
+
+		if (OutTexels.Num() == 0)
+			return true;
+
+		switch (TexturePage->GetComponentType())
+		{
+			case InstaLOD::IInstaLODTexturePage::ComponentTypeUInt8:
+				return ConvertPixelType<uint8>(TexturePage, OutTexels.GetData(), bFlipY);
+			case InstaLOD::IInstaLODTexturePage::ComponentTypeUInt16:
+				return ConvertPixelType<uint16>(TexturePage, OutTexels.GetData(), bFlipY);
+			case InstaLOD::IInstaLODTexturePage::ComponentTypeFloat32:
+				return ConvertPixelType<float>(TexturePage, OutTexels.GetData(), bFlipY);
+		}
+		return false;
+	}
+}
+
+bool FInstaLODTexturePageConversion::ConvertToColor(const InstaLOD::IInstaLODTexturePage *const TexturePage, TArray<FColor>& OutTexels, const bool bFlipY)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLODTexturePageConversion::ConvertToColor);
+	return UEInstaLODTexturePageConversionHelper::ConvertPage(TexturePage, OutTexels, bFlipY);
+}
+
+bool FInstaLODTexturePageConversion::ConvertToFloat16Color(const InstaLOD::IInstaLODTexturePage *const TexturePage, TArray<FFloat16Color>& OutTexels, const bool bFlipY)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLODTexturePageConversion::ConvertToFloat16Color);
+	return UEInstaLODTexturePageConversionHelper::ConvertPage(TexturePage, OutTexels, bFlipY);
+}
+
+bool FInstaLODTexturePageConversion::ConvertToRGBA16(const InstaLOD::IInstaLODTexturePage *const TexturePage, TArray<uint16>& OutComponents, const bool bFlipY)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLODTexturePageConversion::ConvertToRGBA16);
+	return UEInstaLODTexturePageConversionHelper::CopyPage16<4>(TexturePage, OutComponents, bFlipY);
+}
+
+bool FInstaLODTexturePageConversion::ConvertToG16(const InstaLOD::IInstaLODTexturePage *const TexturePage, TArray<uint16>& OutComponents, const bool bFlipY)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLODTexturePageConversion::ConvertToG16);
+	return UEInstaLODTexturePageConversionHelper::CopyPage16<1>(TexturePage, OutComponents, bFlipY);
+}
+
+bool FInstaLODTexturePageConversion::FindConstantValue(const TArray<FColor>& Texels, const int32 Tolerance, FColor& OutValue)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FInstaLODTexturePageConversion::FindConstantValue);
+	using namespace UEInstaLODTexturePageConversionHelper;
+
+	if (Texels.Num() == 0 || Tolerance < 0)
+		return false;
+
+	const int32 BlockCount = FMath::DivideAndRoundUp(Texels.Num(), kTexelChunkSize);
+	TArray<FTexelRange> BlockRanges;
+	BlockRanges.SetNum(BlockCount);
+	std::atomic<bool> bIsConstant(true);
+
+	ParallelFor(BlockCount, [&](const int32 BlockIndex)
+	{
+		// NOTE: most pages vary early, blocks are skipped once any block exceeded the tolerance
+		if (!bIsConstant.load(std::memory_order_relaxed))
+			return;
+
+		const int32 FirstIndex = BlockIndex * kTexelChunkSize;
+		const int32 EndIndex = FMath::Min(FirstIndex + kTexelChunkSize, Texels.Num());
+		const uint8 *const Components = (const uint8*)(Texels.GetData() + FirstIndex);
+		FTexelRange& Range = BlockRanges[BlockIndex];
+
+		for (int32 ComponentIndex=0; ComponentIndex<(EndIndex - FirstIndex) * 4; ComponentIndex+=4)
+		{
+			for (int32 Channel=0; Channel<4; Channel++)
+			{
+				Range.Min[Channel] = FMath::Min(Range.Min[Channel], Components[ComponentIndex + Channel]);
+				Range.Max[Channel] = FMath::Max(Range.Max[Channel], Components[ComponentIndex + Channel]);
+			}
+		}
+
+		if (!Range.IsWithinTolerance(Tolerance))
+		{
+			bIsConstant = false;
+		}
+	}, IsParallelConversionDisabled());
+
+	if (!bIsConstant)
+		return false;
+
+	FTexelRange PageRange;
+	for (const FTexelRange& Range : BlockRanges)
+	{
+		PageRange.Add(Range);
+	}
+
+	if (!PageRange.IsWithinTolerance(Tolerance))
+		return false;
+
+	// NOTE: FColor is stored as BGRA, the channel ranges are in memory order
+	uint8 *const Value = (uint8*)&OutValue;
+	for (int32 Channel=0; Channel<4; Channel++)
+	{
+		Value[Channel] = (uint8)(((uint32)PageRange.Min[Channel] + (uint32)PageRange.Max[Channel] + 1u) / 2u);
+	}
+	return true;
+}
+
+int32 FInstaLODTexturePageConversion::GetConstantPageTolerance()
+{
+	static const TConsoleVariableData<int32>* const ConstantPageToleranceCVar = IConsoleManager::Get().FindTConsoleVariableDataInt(TEXT("InstaLOD.ConstantPageTolerance"));
+	return ConstantPageToleranceCVar != nullptr ? ConstantPageToleranceCVar->GetValueOnAnyThread() : -1;
+}
@@ -27,6 +27,10 @@
 #include "LevelEditor.h"
 
 #include "Interfaces/IPluginManager.h"
+#include "InstaLOD/InstaLODStats.h"
+#include "InstaLOD/InstaLODMeshPool.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
 
 #include "Editor/EditorStyle/Private/SlateEditorStyle.h"
 
@@ -40,6 +44,199 @@ FString InstaLODShared::LicenseInformation = TEXT("Unauthorized");
 
 #define LOCTEXT_NAMESPACE "InstaLOD"
 
+namespace UEInstaLODStatsHelper
+{
+	/** The aggregated samples of a single operation type. */
+	struct FOperationStats
+	{
+		uint64 CallCount = 0u;
+		uint64 FailureCount = 0u;
+		double TotalWallTimeInSeconds = 0.0;
+		uint64 InputTriangles = 0u;
+		uint64 OutputTriangles = 0u;
+		int64 PeakMeshSizeInBytes = 0;
+		uint64 MessageCount = 0u;
+		TArray<float> WallTimes;	/**< Wall time of every call, required for percentiles. */
+
+		double GetMeanWallTime() const
+		{
+			return CallCount > 0u ? TotalWallTimeInSeconds / (double)CallCount : 0.0;
+		}
+
+		double GetPercentileWallTime(const double Percentile) const
+		{
+			if (WallTimes.Num() == 0)
+				return 0.0;
+
+			TArray<float> SortedWallTimes = WallTimes;
+			SortedWallTimes.Sort();
+
+			const int32 Index = FMath::Clamp(FMath::CeilToInt32(Percentile * SortedWallTimes.Num()) - 1, 0, SortedWallTimes.Num() - 1);
+			return SortedWallTimes[Index];
+		}
+
+		double GetTrianglesPerSecond(const uint64 Triangles) const
+		{
+			return TotalWallTimeInSeconds > 0.0 ? (double)Triangles / TotalWallTimeInSeconds : 0.0;
+		}
+	};
+
+	static FCriticalSection StatsLock;
+	static FOperationStats OperationStats[(int32)EInstaLODStatsOperation::Count];
+	static FInstaLODStats::FConversionTotals ConversionTotals[(int32)EInstaLODStatsConversion::Count];
+
+	static void WriteCSV(const TArray<FString>& Args)
+	{
+		const FString FilePath = Args.Num() > 0 ? Args[0] : FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("InstaLOD"), FString::Printf(TEXT("Stats-%s.csv"), *FDateTime::Now().ToString()));
+
+		if (FFileHelper::SaveStringToFile(FInstaLODStats::ToCSV(), *FilePath))
+		{
+			UE_LOG(LogInstaLOD, Display, TEXT("Wrote InstaLOD stats to \"%s\"."), *FilePath);
+		}
+		else
+		{
+			UE_LOG(LogInstaLOD, Error, TEXT("Failed to write InstaLOD stats to \"%s\"."), *FilePath);
+		}
+	}
+
+	static FAutoConsoleCommandWithOutputDevice StatsCommand(TEXT("InstaLOD.Stats"), TEXT("Prints the InstaLOD operation stats of this session."),
+		FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& OutputDevice) { OutputDevice.Log(FInstaLODStats::ToString()); }));
+	static FAutoConsoleCommand StatsResetCommand(TEXT("InstaLOD.Stats.Reset"), TEXT("Resets the InstaLOD operation stats."),
+		FConsoleCommandDelegate::CreateStatic(&FInstaLODStats::Reset));
+	static FAutoConsoleCommand StatsCSVCommand(TEXT("InstaLOD.Stats.CSV"), TEXT("Writes the InstaLOD operation stats to a CSV file. Optionally specify the file path, by default the file is written to the saved directory."),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&WriteCSV));
+}
+
+void FInstaLODStats::Record(const EInstaLODStatsOperation Operation, const FSample& Sample)
+{
+	using namespace UEInstaLODStatsHelper;
+	check(Operation < EInstaLODStatsOperation::Count);
+
+	FScopeLock ScopeLock(&StatsLock);
+	FOperationStats& Stats = OperationStats[(int32)Operation];
+
+	Stats.CallCount++;
+	Stats.FailureCount += Sample.bSuccess ? 0u : 1u;
+	Stats.TotalWallTimeInSeconds += Sample.WallTimeInSeconds;
+	Stats.InputTriangles += Sample.InputTriangles;
+	Stats.OutputTriangles += Sample.OutputTriangles;
+	Stats.PeakMeshSizeInBytes = FMath::Max(Stats.PeakMeshSizeInBytes, Sample.MeshSizeInBytes);
+	Stats.MessageCount += Sample.MessageCount;
+	Stats.WallTimes.Add((float)Sample.WallTimeInSeconds);
+}
+
+void FInstaLODStats::RecordConversion(const EInstaLODStatsConversion Conversion, const double WallTimeInSeconds, const int64 MeshSizeInBytes)
+{
+	using namespace UEInstaLODStatsHelper;
+	check(Conversion < EInstaLODStatsConversion::Count);
+
+	FScopeLock ScopeLock(&StatsLock);
+	FConversionTotals& Totals = ConversionTotals[(int32)Conversion];
+
+	Totals.CallCount++;
+	Totals.WallTimeInSeconds += WallTimeInSeconds;
+	Totals.MeshSizeInBytes += MeshSizeInBytes;
+}
+
+void FInstaLODStats::Reset()
+{
+	using namespace UEInstaLODStatsHelper;
+
+	FScopeLock ScopeLock(&StatsLock);
+	for (FOperationStats& Stats : OperationStats)
+	{
+		Stats = FOperationStats();
+	}
+	for (FConversionTotals& Totals : ConversionTotals)
+	{
+		Totals = FConversionTotals();
+	}
+}
+
+FInstaLODStats::FConversionTotals FInstaLODStats::GetConversionTotals(const EInstaLODStatsConversion Conversion)
+{
+	using namespace UEInstaLODStatsHelper;
+	check(Conversion < EInstaLODStatsConversion::Count);
+
+	FScopeLock ScopeLock(&StatsLock);
+	return ConversionTotals[(int32)Conversion];
+}
+
+FString FInstaLODStats::ToString()
+{
+	using namespace UEInstaLODStatsHelper;
+
+	FScopeLock ScopeLock(&StatsLock);
+	FString Result = FString::Printf(TEXT("InstaLOD stats (%s):\n"), *InstaLODShared::Version);
+	Result += FString::Printf(TEXT("%-16s %8s %8s %10s %10s %10s %14s %14s %12s %10s\n"), TEXT("Operation"), TEXT("Calls"), TEXT("Failures"),
+							  TEXT("Total [s]"), TEXT("Mean [s]"), TEXT("P95 [s]"), TEXT("In Tris/s"), TEXT("Out Tris/s"), TEXT("Peak [MB]"), TEXT("Messages"));
+
+	for (int32 OperationIndex=0; OperationIndex<(int32)EInstaLODStatsOperation::Count; OperationIndex++)
+	{
+		const FOperationStats& Stats = OperationStats[OperationIndex];
+
+		if (Stats.CallCount == 0u)
+			continue;
+
+		Result += FString::Printf(TEXT("%-16s %8llu %8llu %10.3f %10.3f %10.3f %14.0f %14.0f %12.2f %10llu\n"), GetOperationName((EInstaLODStatsOperation)OperationIndex),
+								  Stats.CallCount, Stats.FailureCount, Stats.TotalWallTimeInSeconds, Stats.GetMeanWallTime(), Stats.GetPercentileWallTime(0.95),
+								  Stats.GetTrianglesPerSecond(Stats.InputTriangles), Stats.GetTrianglesPerSecond(Stats.OutputTriangles),
+								  (double)Stats.PeakMeshSizeInBytes / (1024.0 * 1024.0), Stats.MessageCount);
+	}
+
+	const FConversionTotals& ConvertIn = ConversionTotals[(int32)EInstaLODStatsConversion::ConvertIn];
+	const FConversionTotals& ConvertOut = ConversionTotals[(int32)EInstaLODStatsConversion::ConvertOut];
+	Result += FString::Printf(TEXT("Mesh conversions: %llu in (%.3fs), %llu out (%.3fs)\n"), ConvertIn.CallCount, ConvertIn.WallTimeInSeconds, ConvertOut.CallCount, ConvertOut.WallTimeInSeconds);
+	return Result;
+}
+
+FString FInstaLODStats::ToCSV()
+{
+	using namespace UEInstaLODStatsHelper;
+
+	FScopeLock ScopeLock(&StatsLock);
+	FString Result = TEXT("Operation,SDKVersion,Calls,Failures,TotalSeconds,MeanSeconds,P95Seconds,InputTriangles,OutputTriangles,InputTrianglesPerSecond,OutputTrianglesPerSecond,PeakMeshBytes,Messages\n");
+
+	for (int32 OperationIndex=0; OperationIndex<(int32)EInstaLODStatsOperation::Count; OperationIndex++)
+	{
+		const FOperationStats& Stats = OperationStats[OperationIndex];
+
+		// NOTE: the SDK version is quoted as it's the SDK build date
+		Result += FString::Printf(TEXT("%s,\"%s\",%llu,%llu,%f,%f,%f,%llu,%llu,%f,%f,%lld,%llu\n"), GetOperationName((EInstaLODStatsOperation)OperationIndex), *InstaLODShared::Version,
+								  Stats.CallCount, Stats.FailureCount, Stats.TotalWallTimeInSeconds, Stats.GetMeanWallTime(), Stats.GetPercentileWallTime(0.95),
+								  Stats.InputTriangles, Stats.OutputTriangles, Stats.GetTrianglesPerSecond(Stats.InputTriangles), Stats.GetTrianglesPerSecond(Stats.OutputTriangles),
+								  Stats.PeakMeshSizeInBytes, Stats.MessageCount);
+	}
+	return Result;
+}
+
+const TCHAR* FInstaLODStats::GetOperationName(const EInstaLODStatsOperation Operation)
+{
+	switch (Operation)
+	{
+		case EInstaLODStatsOperation::Optimize:			return TEXT("Optimize");
+		case EInstaLODStatsOperation::SkeletalReduce:	return TEXT("SkeletalReduce");
+		case EInstaLODStatsOperation::ProxyLOD:			return TEXT("ProxyLOD");
+		case EInstaLODStatsOperation::Remesh:			return TEXT("Remesh");
+		case EInstaLODStatsOperation::Imposterize:		return TEXT("Imposterize");
+		case EInstaLODStatsOperation::Bake:				return TEXT("Bake");
+		case EInstaLODStatsOperation::MeshTool:			return TEXT("MeshTool");
+		default:										return TEXT("Unknown");
+	}
+}
+
+uint64 FInstaLODStats::GetTriangleCount(const InstaLOD::IInstaLODMesh *const Mesh)
+{
+	InstaLOD::uint64 WedgeCount = 0u;
+	Mesh->GetWedgeIndices(&WedgeCount);
+	return WedgeCount / 3u;
+}
+
+int64 FInstaLODStats::GetMeshSizeInBytes(const InstaLOD::IInstaLODMesh *const Mesh)
+{
+	return FInstaLODMeshPool::EstimateMeshSizeInBytes(Mesh);
+}
+
 #define UE_INSTALOD_LIBRARY_NAME	"InstaLOD"
 
 // library file name depends on target platform
@@ -18,6 +18,8 @@
 #include "MeshUtilities.h"
 #include "SkeletalMeshReductionSettings.h"
 #include "Engine/SkinnedAssetCommon.h"
+#include "Async/Future.h"
+#include "HAL/CriticalSection.h"
 
 namespace InstaLOD
 {
@@ -26,8 +28,16 @@ namespace InstaLOD
 	class IInstaLODMaterial;
 	class IInstaLODMesh;
 	class IInstaLODSkeleton;
+	class IOptimizeOperation;
+	struct OptimizeResult;
+	struct OptimizeSettings;
 };
 
+class FInstaLODExecutionContext;
+class FInstaLODExecutionContextPool;
+class FInstaLODLogSink;
+class FInstaLODMeshPool;
+
 struct UE_SkeletalBakePoseData
 {
 	UE_SkeletalBakePoseData() : BakePoseAnimation(nullptr), ReferenceSkeleton(nullptr), SkeletalMesh(nullptr)
@@ -37,6 +47,19 @@ struct UE_SkeletalBakePoseData
 	USkeletalMesh* SkeletalMesh;
 };
 
+/**
+ * Specifies the order in which the mesh converters transfer faces and wedges.
+ * InstaLOD meshes use the opposite winding of UE meshes, the converters write and read
+ * the corners in reversed order instead of flipping the InstaLOD mesh in a separate pass.
+ */
+enum class EInstaLODWindingMode : uint8
+{
+	/** Faces and wedges are reversed during conversion so that both meshes face the same direction. */
+	Convert,
+	/** Faces and wedges are transferred in InstaLOD order, e.g. to match a RawMesh converted from the same mesh. */
+	Preserve
+};
+
 class IInstaLOD
 {
 public:
@@ -50,12 +73,14 @@ public:
 	
 	virtual ~IInstaLOD() {}
 	
+	/** Allocates an empty mesh, meshes are taken from a pool and should be deallocated with DeallocInstaLODMesh to be reused. */
 	virtual InstaLOD::IInstaLODMesh* AllocInstaLODMesh() = 0;
+	virtual void DeallocInstaLODMesh(InstaLOD::IInstaLODMesh* Mesh) = 0;
 	virtual InstaLOD::IInstaLODSkeleton* AllocInstaLODSkeleton() = 0;
 	
 	virtual bool ConvertInstaLODMeshToRawMesh(InstaLOD::IInstaLODMesh* InMesh, struct FRawMesh &OutMesh) = 0;
 	virtual bool ConvertMeshDescriptionToInstaLODMesh(const struct FMeshDescription &InMesh, InstaLOD::IInstaLODMesh* OutMesh) = 0;
-	virtual bool ConvertInstaLODMeshToMeshDescription(InstaLOD::IInstaLODMesh* InMesh, const TMap<int32, FName> &MaterialMapOut, struct FMeshDescription &OutMesh) = 0;
+	virtual bool ConvertInstaLODMeshToMeshDescription(InstaLOD::IInstaLODMesh* InMesh, const TMap<int32, FName> &MaterialMapOut, struct FMeshDescription &OutMesh, const EInstaLODWindingMode WindingMode = EInstaLODWindingMode::Convert) = 0;
 	virtual bool ConvertSkeletalLODModelToInstaLODMesh(const UE_StaticLODModel& InMesh, InstaLOD::IInstaLODMesh *const OutMesh, UE_SkeletalBakePoseData *const BakePoseData = nullptr) = 0;
 	virtual bool ConvertInstaLODMeshToSkeletalLODModel(InstaLOD::IInstaLODMesh *const InMesh, class USkeletalMesh* SourceSkeletalMesh, class FSkeletalMeshImportData& ImportData, UE_StaticLODModel& OutMesh) = 0;
 	
@@ -65,13 +90,26 @@ public:
 	virtual bool ConvertReferenceSkeletonToInstaLODSkeleton(const FReferenceSkeleton& ReferenceSkeleton, InstaLOD::IInstaLODSkeleton *const InstaSkeleton, TMap<int32, TPair<uint32, FString>>& OutUEBoneIndexToInstaLODBoneIndex) = 0;
 	virtual void UnbindClothAtLODIndex(USkeletalMesh* SkeletalMesh, const int32 LODIndex) = 0;
 
+	/**
+	 * Reduces the input mesh to multiple LODs.
+	 * The input mesh is converted and sanitized once, all LODs are then optimized concurrently from the shared input.
+	 *
+	 * @param InMesh the input mesh.
+	 * @param ReductionSettings the reduction settings for each LOD.
+	 * @param OutReducedMeshes the reduced mesh for each LOD, LODs that failed to optimize contain the input mesh.
+	 * @param OutMaxDeviations the max deviation for each LOD.
+	 * @return true if all LODs were optimized successfully.
+	 */
+	virtual bool ReduceMeshDescriptionLODs(const struct FMeshDescription& InMesh, const TArray<struct FMeshReductionSettings>& ReductionSettings,
+										   TArray<struct FMeshDescription>& OutReducedMeshes, TArray<float>& OutMaxDeviations) = 0;
+
 	virtual InstaLOD::IInstaLOD* GetInstaLOD() = 0;
 };
 
 class FInstaLOD : public IMeshReduction, public IMeshMerging, public IInstaLOD
 {
 public:
-	virtual ~FInstaLOD() { }
+	virtual ~FInstaLOD();
 	
 	virtual const FString& GetVersionString() const override
 	{
@@ -122,10 +160,11 @@ public:
 	}
 	
 	virtual InstaLOD::IInstaLODMesh* AllocInstaLODMesh();
+	virtual void DeallocInstaLODMesh(InstaLOD::IInstaLODMesh* Mesh);
 	virtual InstaLOD::IInstaLODSkeleton* AllocInstaLODSkeleton();
 	
 	virtual bool ConvertInstaLODMeshToRawMesh(InstaLOD::IInstaLODMesh* InMesh, struct FRawMesh &OutMesh);
-	virtual bool ConvertInstaLODMeshToMeshDescription(InstaLOD::IInstaLODMesh* InMesh, const TMap<int32, FName> &MaterialMapOut, struct FMeshDescription &OutMesh);
+	virtual bool ConvertInstaLODMeshToMeshDescription(InstaLOD::IInstaLODMesh* InMesh, const TMap<int32, FName> &MaterialMapOut, struct FMeshDescription &OutMesh, const EInstaLODWindingMode WindingMode = EInstaLODWindingMode::Convert);
 	virtual bool ConvertMeshDescriptionToInstaLODMesh(const struct FMeshDescription &InMesh, InstaLOD::IInstaLODMesh* OutMesh);
 	
 	virtual bool ConvertSkeletalLODModelToInstaLODMesh(const UE_StaticLODModel& InMesh, InstaLOD::IInstaLODMesh *const OutMesh, UE_SkeletalBakePoseData *const BakePoseData = nullptr);
@@ -142,7 +181,10 @@ public:
 	virtual void AggregateLOD();
 
 	virtual void UnbindClothAtLODIndex(USkeletalMesh* SkeletalMesh, const int32 LODIndex) override;
-	
+
+	virtual bool ReduceMeshDescriptionLODs(const struct FMeshDescription& InMesh, const TArray<struct FMeshReductionSettings>& ReductionSettings,
+										   TArray<struct FMeshDescription>& OutReducedMeshes, TArray<float>& OutMaxDeviations) override;
+
 	static FInstaLOD* Create(InstaLOD::IInstaLOD *InstaLODAPI)
 	{
 		return new FInstaLOD(InstaLODAPI);
@@ -156,18 +198,43 @@ public:
 private:
 	explicit FInstaLOD(InstaLOD::IInstaLOD *InstaLODAPI);
 	
+	/** Optimizes the input mesh with the operation of the execution context or loads the result from the LOD cache. */
+	InstaLOD::OptimizeResult OptimizeWithResultCache(FInstaLODExecutionContext& Context, const InstaLOD::IInstaLODMesh *const InstaMesh,
+													 InstaLOD::IInstaLODMesh*& OutMesh, const InstaLOD::OptimizeSettings& OptimizeSettings);
+	
+	void FinalizeReducedMesh(InstaLOD::IInstaLODMesh *const ResultMesh, InstaLOD::OptimizeResult& InstaResult, const FString& OptimizeLog,
+							 const TMap<int32, FName>& OutMaterialMap, FMeshDescription& OutReducedMesh, float& OutMaxDeviation);
+	
 	void ReduceSkeletalMeshAtLODIndex(class USkeletalMesh* SkeletalMesh, int32 LODIndex,
 									  const FSkeletalMeshOptimizationSettings& Settings, bool bCalcLODDistance, const class ITargetPlatform* TargetPlatform);
 	
 	void PostProcessReducedSkeletalMesh(class USkeletalMesh* SkeletalMesh, UE_StaticLODModel& OutputLODModel, float& OutMaxDeviation,
 										const FSkeletalMeshOptimizationSettings& Settings, const float ElapsedTime);
 	
+	/** Builds the proxy mesh and material of the merge data, called by ProxyLOD on the calling thread or on a worker thread. */
+	void BuildProxy(const TArray<struct FMeshMergeData>& InData, const struct FMeshProxySettings& InProxySettings,
+					const TArray<struct FFlattenMaterial>& InputMaterials, struct FMeshDescription& OutProxyMesh, struct FFlattenMaterial& OutMaterial);
+	
 	void PostProcessMergedRawMesh(FMeshDescription& OutProxyMesh, FFlattenMaterial& OutMaterial, const FMeshProxySettings& InProxySettings, const float ElapsedTime);
 	
-	void DispatchNotification(const FText& InText, /*SNotificationItem::ECompletionState*/int32 type);
+	/** Dispatches an editor notification, notifications of other threads are forwarded to the game thread. */
+	static void DispatchNotification(const FText& InText, /*SNotificationItem::ECompletionState*/int32 type);
 	
 	FString VersionString;
 	InstaLOD::IInstaLOD *InstaLOD;
+	
+	/** Streams the SDK output into LogInstaLOD, nullptr if the SDK output can't be redirected on this platform. */
+	TUniquePtr<FInstaLODLogSink> LogSink;
+	
+	/** Per-worker execution contexts, see FInstaLODExecutionContext for the thread-safety contract. */
+	TUniquePtr<FInstaLODExecutionContextPool> ExecutionContexts;
+	
+	/** Released meshes retained for reuse by AllocInstaLODMesh. */
+	TUniquePtr<FInstaLODMeshPool> MeshPool;
+	
+	/** Proxies built asynchronously by ProxyLOD, the builds are awaited on destruction. */
+	FCriticalSection PendingProxyBuildsLock;
+	TArray<TFuture<void>> PendingProxyBuilds;
 };
 
 #endif
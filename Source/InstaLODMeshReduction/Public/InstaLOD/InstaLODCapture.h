@@ -0,0 +1,116 @@
+/**
+ * InstaLODCapture.h (InstaLOD)
+ *
+ * Copyright 2016-2023 InstaLOD GmbH - All Rights Reserved.
+ *
+ * Unauthorized copying of this file, via any medium is strictly prohibited.
+ * This file and all it's contents are proprietary and confidential.
+ *
+ * @file InstaLODCapture.h
+ * @copyright 2016-2023 InstaLOD GmbH. All rights reserved.
+ * @section License
+ */
+
+#ifndef InstaLOD_InstaLODCapture_h
+#define InstaLOD_InstaLODCapture_h
+
+#include "CoreMinimal.h"
+
+class FJsonObject;
+
+namespace InstaLOD
+{
+	class IInstaLOD;
+	class IInstaLODMesh;
+	class IInstaLODMaterialData;
+	struct MeshMergeSettings;
+	struct OptimizeSettings;
+	struct RemeshingSettings;
+};
+
+/**
+ * Records the converted input meshes and the resolved settings of an InstaLOD operation, so that
+ * the operation can be re-executed offline with the InstaLOD SDK.
+ * A capture is a directory with the input meshes written by IInstaLODMeshBase::Serialize and a
+ * 'Capture.json' manifest that contains the operation and its settings. The capture is complete
+ * once the manifest has been written when the capture is destroyed.
+ * Captures are written while 'InstaLOD.Capture' is set, replay them with '-run=InstaLODReplay'.
+ * NOTE: a capture must only be used by a single thread, multiple captures can be written concurrently.
+ */
+class INSTALODMESHREDUCTION_API FInstaLODCapture
+{
+public:
+	/** The operations that can be captured and replayed. */
+	enum class EOperation : uint8
+	{
+		Optimize,
+		SkeletalOptimize,
+		MeshMerge,
+		Remesh
+	};
+
+	/** The result of a replayed capture. */
+	struct FReplayResult
+	{
+		FString Operation;
+		bool bSuccess = false;
+		double WallTimeInSeconds = 0.0;	/**< The execution time of the operation, excluding the loading of the capture. */
+		uint64 InputTriangles = 0u;
+		uint64 OutputTriangles = 0u;
+		FString Error;
+	};
+
+	/**
+	 * Begins a new capture.
+	 *
+	 * @param CaptureSetting the value of 'InstaLOD.Capture': empty or '0' disables capturing,
+	 *						 '1' captures to the default directory, any other value is used as the capture directory.
+	 * @param InOperation the captured operation.
+	 */
+	FInstaLODCapture(const FString& CaptureSetting, const EOperation InOperation);
+	~FInstaLODCapture();
+
+	/** Gets whether the capture is recording. */
+	bool IsActive() const { return !Directory.IsEmpty(); }
+
+	/**
+	 * Serializes an input mesh of the operation.
+	 *
+	 * @param Mesh the input mesh as it is passed to the operation.
+	 * @param MaterialData (optional) the material data of the operation, must only be specified once per capture.
+	 */
+	void AddMesh(const InstaLOD::IInstaLODMesh *const Mesh, const InstaLOD::IInstaLODMaterialData *const MaterialData = nullptr);
+
+	void SetOptimizeSettings(const InstaLOD::OptimizeSettings& Settings);
+	void SetMeshMergeSettings(const InstaLOD::MeshMergeSettings& Settings);
+	void SetRemeshingSettings(const InstaLOD::RemeshingSettings& Settings);
+
+	/** Gets the directory new captures are written to when 'InstaLOD.Capture' is set to '1'. */
+	static FString GetDefaultCaptureRoot();
+
+	/**
+	 * Finds all complete captures.
+	 *
+	 * @param Path a capture directory or a directory that contains captures.
+	 * @param OutCaptureDirectories the sorted capture directories.
+	 */
+	static void FindCaptures(const FString& Path, TArray<FString>& OutCaptureDirectories);
+
+	/**
+	 * Re-executes a capture with the InstaLOD SDK.
+	 *
+	 * @param InstaLOD the InstaLOD API.
+	 * @param CaptureDirectory the capture directory that contains the manifest.
+	 * @param OutResult the replay result.
+	 * @return true if the capture was replayed successfully.
+	 */
+	static bool Replay(InstaLOD::IInstaLOD *const InstaLOD, const FString& CaptureDirectory, FReplayResult& OutResult);
+
+private:
+	FString Directory;
+	EOperation Operation;
+	TSharedPtr<FJsonObject> Manifest;
+	int32 MeshCount;
+};
+
+#endif
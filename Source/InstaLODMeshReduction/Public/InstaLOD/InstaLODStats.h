@@ -0,0 +1,127 @@
+/**
+ * InstaLODStats.h (InstaLOD)
+ *
+ * Copyright 2016-2023 InstaLOD GmbH - All Rights Reserved.
+ *
+ * Unauthorized copying of this file, via any medium is strictly prohibited.
+ * This file and all it's contents are proprietary and confidential.
+ *
+ * @file InstaLODStats.h
+ * @copyright 2016-2023 InstaLOD GmbH. All rights reserved.
+ * @section License
+ */
+
+#ifndef InstaLOD_InstaLODStats_h
+#define InstaLOD_InstaLODStats_h
+
+#include "CoreMinimal.h"
+
+namespace InstaLOD
+{
+	class IInstaLODMesh;
+};
+
+/** The operation types aggregated by the session stats. */
+enum class EInstaLODStatsOperation : uint8
+{
+	Optimize,
+	SkeletalReduce,
+	ProxyLOD,
+	Remesh,
+	Imposterize,
+	Bake,
+	MeshTool,	/**< Mesh tools without a dedicated operation type. */
+	Count
+};
+
+/** The mesh conversion directions aggregated by the session stats. */
+enum class EInstaLODStatsConversion : uint8
+{
+	ConvertIn,	/**< Conversion of UE meshes to InstaLOD meshes. */
+	ConvertOut,	/**< Conversion of InstaLOD meshes to UE meshes. */
+	Count
+};
+
+/**
+ * Session metrics of all InstaLOD operations, aggregated per operation type.
+ * The stats can be printed with 'InstaLOD.Stats', written to a CSV file with 'InstaLOD.Stats.CSV'
+ * and reset with 'InstaLOD.Stats.Reset'.
+ * NOTE: all methods are thread-safe.
+ */
+class INSTALODMESHREDUCTION_API FInstaLODStats
+{
+public:
+	/** A single operation sample. */
+	struct FSample
+	{
+		double WallTimeInSeconds = 0.0;
+		uint64 InputTriangles = 0u;
+		uint64 OutputTriangles = 0u;
+		int64 MeshSizeInBytes = 0;	/**< The largest mesh processed by the operation. */
+		uint32 MessageCount = 0u;	/**< The amount of SDK output lines attributed to the operation. */
+		bool bSuccess = true;
+	};
+
+	/** The accumulated mesh conversions of a single direction. */
+	struct FConversionTotals
+	{
+		uint64 CallCount = 0u;
+		double WallTimeInSeconds = 0.0;	/**< NOTE: conversions running concurrently on multiple threads are accumulated. */
+		int64 MeshSizeInBytes = 0;		/**< The accumulated size of all converted InstaLOD meshes. */
+	};
+
+	static void Record(const EInstaLODStatsOperation Operation, const FSample& Sample);
+	static void RecordConversion(const EInstaLODStatsConversion Conversion, const double WallTimeInSeconds, const int64 MeshSizeInBytes);
+	static void Reset();
+
+	/** Gets the conversions of the direction since the last reset, sample the totals before and after an operation to get the conversions of the operation. */
+	static FConversionTotals GetConversionTotals(const EInstaLODStatsConversion Conversion);
+
+	/** Gets a human readable table of the stats. */
+	static FString ToString();
+
+	/** Gets the stats as comma separated values, one row per operation type. */
+	static FString ToCSV();
+
+	static const TCHAR* GetOperationName(const EInstaLODStatsOperation Operation);
+
+	/** Gets the amount of triangles of the mesh. */
+	static uint64 GetTriangleCount(const InstaLOD::IInstaLODMesh *const Mesh);
+
+	/** Gets the estimated size of the mesh buffers. */
+	static int64 GetMeshSizeInBytes(const InstaLOD::IInstaLODMesh *const Mesh);
+};
+
+/** Records an operation sample with the wall time of the scope when the scope is left. */
+class FInstaLODScopedStatsSample
+{
+public:
+	explicit FInstaLODScopedStatsSample(const EInstaLODStatsOperation InOperation) :
+	Operation(InOperation),
+	StartTime(FPlatformTime::Seconds())
+	{
+	}
+
+	~FInstaLODScopedStatsSample()
+	{
+		Sample.WallTimeInSeconds = FPlatformTime::Seconds() - StartTime;
+		FInstaLODStats::Record(Operation, Sample);
+	}
+
+	/** Updates the triangle counts and the peak mesh size from the input and output mesh. */
+	void SetMeshes(const InstaLOD::IInstaLODMesh *const InputMesh, const InstaLOD::IInstaLODMesh *const OutputMesh)
+	{
+		Sample.InputTriangles = InputMesh != nullptr ? FInstaLODStats::GetTriangleCount(InputMesh) : 0u;
+		Sample.OutputTriangles = OutputMesh != nullptr ? FInstaLODStats::GetTriangleCount(OutputMesh) : 0u;
+		Sample.MeshSizeInBytes = FMath::Max(InputMesh != nullptr ? FInstaLODStats::GetMeshSizeInBytes(InputMesh) : 0,
+											OutputMesh != nullptr ? FInstaLODStats::GetMeshSizeInBytes(OutputMesh) : 0);
+	}
+
+	FInstaLODStats::FSample Sample;
+
+private:
+	const EInstaLODStatsOperation Operation;
+	const double StartTime;
+};
+
+#endif
@@ -0,0 +1,91 @@
+/**
+ * InstaLODTexturePageConversion.h (InstaLOD)
+ *
+ * Copyright 2016-2023 InstaLOD GmbH - All Rights Reserved.
+ *
+ * Unauthorized copying of this file, via any medium is strictly prohibited.
+ * This file and all it's contents are proprietary and confidential.
+ *
+ * @file InstaLODTexturePageConversion.h
+ * @copyright 2016-2023 InstaLOD GmbH. All rights reserved.
+ * @section License
+ */
+
+#ifndef InstaLOD_InstaLODTexturePageConversion_h
+#define InstaLOD_InstaLODTexturePageConversion_h
+
+#include "CoreMinimal.h"
+#include "Math/Float16Color.h"
+
+namespace InstaLOD
+{
+	class IInstaLODTexturePage;
+};
+
+/**
+ * Converts the texels of InstaLOD texture pages to UE pixel formats in bulk.
+ * The page data is read directly from IInstaLODTexturePage::GetData according to the component and pixel type
+ * of the page, rows are converted in parallel. The result is identical to sampling every texel with
+ * IInstaLODTexturePage::SampleFloat, channels that are not stored by the page are expanded:
+ * luminance is replicated to the green and blue channels and the alpha channel of pages without alpha is opaque.
+ */
+class INSTALODMESHREDUCTION_API FInstaLODTexturePageConversion
+{
+public:
+	/**
+	 * Converts the page to 8-bit colors, this is identical to FLinearColor::ToFColor without sRGB conversion.
+	 *
+	 * @param TexturePage the texture page.
+	 * @param OutTexels [out] the texels, top row first if bFlipY is set.
+	 * @param bFlipY flips the page vertically, InstaLOD pages start at the bottom row.
+	 * @return true upon success, false if the page layout is not supported.
+	 */
+	static bool ConvertToColor(const InstaLOD::IInstaLODTexturePage *const TexturePage, TArray<FColor>& OutTexels, const bool bFlipY);
+
+	/**
+	 * Converts the page to half precision colors, values of float pages are not clamped.
+	 *
+	 * @param TexturePage the texture page.
+	 * @param OutTexels [out] the texels, top row first if bFlipY is set.
+	 * @param bFlipY flips the page vertically, InstaLOD pages start at the bottom row.
+	 * @return true upon success, false if the page layout is not supported.
+	 */
+	static bool ConvertToFloat16Color(const InstaLOD::IInstaLODTexturePage *const TexturePage, TArray<FFloat16Color>& OutTexels, const bool bFlipY);
+
+	/**
+	 * Copies the texels of a 16-bit page to 16-bit RGBA texels without conversion, four components are written per texel.
+	 *
+	 * @param TexturePage the texture page, the component type must be IInstaLODTexturePage::ComponentTypeUInt16.
+	 * @param OutComponents [out] the texel components, top row first if bFlipY is set.
+	 * @param bFlipY flips the page vertically, InstaLOD pages start at the bottom row.
+	 * @return true upon success, false if the page is not a 16-bit page.
+	 */
+	static bool ConvertToRGBA16(const InstaLOD::IInstaLODTexturePage *const TexturePage, TArray<uint16>& OutComponents, const bool bFlipY);
+
+	/**
+	 * Copies the first channel of a 16-bit page without conversion, this is the luminance of luminance pages
+	 * and the red channel of RGB pages.
+	 *
+	 * @param TexturePage the texture page, the component type must be IInstaLODTexturePage::ComponentTypeUInt16.
+	 * @param OutComponents [out] the first channel of each texel, top row first if bFlipY is set.
+	 * @param bFlipY flips the page vertically, InstaLOD pages start at the bottom row.
+	 * @return true upon success, false if the page is not a 16-bit page.
+	 */
+	static bool ConvertToG16(const InstaLOD::IInstaLODTexturePage *const TexturePage, TArray<uint16>& OutComponents, const bool bFlipY);
+
+	/**
+	 * Determines whether all texels have the same value within the tolerance, the texels are scanned in parallel.
+	 * Pages of constant texels can be collapsed to a single texel or a material constant.
+	 *
+	 * @param Texels the texels.
+	 * @param Tolerance the maximum difference between the smallest and the largest value of each channel.
+	 * @param OutValue [out] the center of the value range of each channel if the texels are constant.
+	 * @return true if the texels are constant within the tolerance.
+	 */
+	static bool FindConstantValue(const TArray<FColor>& Texels, const int32 Tolerance, FColor& OutValue);
+
+	/** Gets the tolerance of 'InstaLOD.ConstantPageTolerance' used to detect constant pages, a negative value disables the detection. */
+	static int32 GetConstantPageTolerance();
+};
+
+#endif
@@ -0,0 +1,725 @@
+/**
+ * InstaLODBenchmarkCommandlet.cpp (InstaLOD)
+ *
+ * Copyright 2016-2023 InstaLOD GmbH - All Rights Reserved.
+ *
+ * Unauthorized copying of this file, via any medium is strictly prohibited.
+ * This file and all it's contents are proprietary and confidential.
+ *
+ * @file InstaLODBenchmarkCommandlet.cpp
+ * @copyright 2016-2023 InstaLOD GmbH. All rights reserved.
+ * @section License
+ */
+
+#include "Commandlets/InstaLODBenchmarkCommandlet.h"
+#include "InstaLODUIPCH.h"
+
+#include "InstaLODModule.h"
+#include "InstaLOD/InstaLODStats.h"
+#include "Utilities/InstaLODUtilities.h"
+
+#include "Algo/Accumulate.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Dom/JsonObject.h"
+#include "Engine/SkeletalMesh.h"
+#include "Engine/StaticMesh.h"
+#include "HAL/ConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "MeshMergeData.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Rendering/SkeletalMeshLODModel.h"
+#include "Rendering/SkeletalMeshModel.h"
+#include "Serialization/JsonSerializer.h"
+#include "StaticMeshAttributes.h"
+#include "StaticMeshOperations.h"
+
+namespace UEInstaLODBenchmarkHelper
+{
+	/** The benchmark options parsed from the commandlet parameters. */
+	struct FOptions
+	{
+		TArray<FString> Shapes = { TEXT("Sphere"), TEXT("Terrain"), TEXT("Noise") };
+		int32 Triangles = 250000;
+		TArray<float> Percentages = { 0.5f, 0.25f, 0.1f };
+		FString AssetPath;
+		TArray<int32> TextureSizes = { 2048, 4096, 8192 };
+		int32 Iterations = 3;
+		FString ReportPath;
+		bool bSkipReduce = false;
+		bool bSkipSkeletal = false;
+		bool bSkipProxy = false;
+		bool bSkipTextures = false;
+
+		void Parse(const FString& Params)
+		{
+			FString Value;
+
+			if (FParse::Value(*Params, TEXT("Shapes="), Value, /*bShouldStopOnSeparator:*/ false))
+			{
+				Value.ParseIntoArray(Shapes, TEXT(","));
+			}
+			if (FParse::Value(*Params, TEXT("Percentages="), Value, /*bShouldStopOnSeparator:*/ false))
+			{
+				TArray<FString> Entries;
+				Value.ParseIntoArray(Entries, TEXT(","));
+				Percentages.Reset();
+
+				for (const FString& Entry : Entries)
+				{
+					Percentages.Add(FMath::Clamp(FCString::Atof(*Entry), 0.0f, 1.0f));
+				}
+			}
+			if (FParse::Value(*Params, TEXT("TextureSizes="), Value, /*bShouldStopOnSeparator:*/ false))
+			{
+				TArray<FString> Entries;
+				Value.ParseIntoArray(Entries, TEXT(","));
+				TextureSizes.Reset();
+
+				for (const FString& Entry : Entries)
+				{
+					TextureSizes.Add(FMath::Clamp(FCString::Atoi(*Entry), 1, 16384));
+				}
+			}
+
+			FParse::Value(*Params, TEXT("Triangles="), Triangles);
+			FParse::Value(*Params, TEXT("Iterations="), Iterations);
+			FParse::Value(*Params, TEXT("Assets="), AssetPath);
+			FParse::Value(*Params, TEXT("Report="), ReportPath);
+			Triangles = FMath::Max(Triangles, 8);
+			Iterations = FMath::Max(Iterations, 1);
+
+			bSkipReduce = FParse::Param(*Params, TEXT("SkipReduce"));
+			bSkipSkeletal = FParse::Param(*Params, TEXT("SkipSkeletal"));
+			bSkipProxy = FParse::Param(*Params, TEXT("SkipProxy"));
+			bSkipTextures = FParse::Param(*Params, TEXT("SkipTextures"));
+
+			if (ReportPath.IsEmpty())
+			{
+				ReportPath = FPaths::ProjectSavedDir() / TEXT("InstaLOD") / FString::Printf(TEXT("Benchmark-%s.json"), *FDateTime::Now().ToString());
+			}
+		}
+	};
+
+	/** A named input mesh of the benchmark. */
+	struct FInput
+	{
+		FString Name;
+		FMeshDescription Mesh;
+	};
+
+	/** The measurements of all iterations of a benchmark case. */
+	struct FCase
+	{
+		FString Suite;
+		FString Input;
+		FString Parameter;
+		TArray<double> Seconds;
+		double ConvertInSeconds = 0.0;	/**< Accumulated conversion time of UE meshes to InstaLOD meshes within the measured operations. */
+		double ConvertOutSeconds = 0.0;	/**< Accumulated conversion time of InstaLOD meshes to UE meshes within the measured operations. */
+		uint64 ConvertInCalls = 0u;
+		uint64 ConvertOutCalls = 0u;
+		uint64 InputTriangles = 0u;
+		uint64 OutputTriangles = 0u;
+		int64 MeshSizeInBytes = 0;		/**< Size of the InstaLOD meshes converted from UE meshes by a single iteration. */
+		bool bSuccess = true;
+
+		/**
+		 * Measures a single iteration of the case.
+		 * NOTE: the conversion times are the conversion stats recorded by the operation itself,
+		 * the difference of the stats before and after the operation contains only the conversions of the operation.
+		 *
+		 * @param Operation the operation, returns whether it succeeded.
+		 */
+		void MeasureIteration(TFunctionRef<bool()> Operation)
+		{
+			const FInstaLODStats::FConversionTotals ConvertInBefore = FInstaLODStats::GetConversionTotals(EInstaLODStatsConversion::ConvertIn);
+			const FInstaLODStats::FConversionTotals ConvertOutBefore = FInstaLODStats::GetConversionTotals(EInstaLODStatsConversion::ConvertOut);
+
+			const double StartTime = FPlatformTime::Seconds();
+			bSuccess &= Operation();
+			Seconds.Add(FPlatformTime::Seconds() - StartTime);
+
+			const FInstaLODStats::FConversionTotals ConvertInAfter = FInstaLODStats::GetConversionTotals(EInstaLODStatsConversion::ConvertIn);
+			const FInstaLODStats::FConversionTotals ConvertOutAfter = FInstaLODStats::GetConversionTotals(EInstaLODStatsConversion::ConvertOut);
+			ConvertInSeconds += ConvertInAfter.WallTimeInSeconds - ConvertInBefore.WallTimeInSeconds;
+			ConvertOutSeconds += ConvertOutAfter.WallTimeInSeconds - ConvertOutBefore.WallTimeInSeconds;
+			ConvertInCalls += ConvertInAfter.CallCount - ConvertInBefore.CallCount;
+			ConvertOutCalls += ConvertOutAfter.CallCount - ConvertOutBefore.CallCount;
+			MeshSizeInBytes = ConvertInAfter.MeshSizeInBytes - ConvertInBefore.MeshSizeInBytes;
+		}
+
+		TSharedRef<FJsonObject> ToJson() const
+		{
+			const int32 Count = FMath::Max(Seconds.Num(), 1);
+			double TotalSeconds = 0.0;
+			double MinSeconds = Seconds.Num() > 0 ? Seconds[0] : 0.0;
+
+			for (const double Value : Seconds)
+			{
+				TotalSeconds += Value;
+				MinSeconds = FMath::Min(MinSeconds, Value);
+			}
+
+			const double MeanSeconds = TotalSeconds / Count;
+			const double ConvertSeconds = (ConvertInSeconds + ConvertOutSeconds) / Count;
+
+			TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+			Object->SetStringField(TEXT("Suite"), Suite);
+			Object->SetStringField(TEXT("Input"), Input);
+			Object->SetStringField(TEXT("Parameter"), Parameter);
+			Object->SetBoolField(TEXT("Success"), bSuccess);
+			Object->SetNumberField(TEXT("Iterations"), Seconds.Num());
+			Object->SetNumberField(TEXT("MeanSeconds"), MeanSeconds);
+			Object->SetNumberField(TEXT("MinSeconds"), MinSeconds);
+			// NOTE: conversions that weren't executed by the operation are reported as null instead of zero
+			SetMeasuredField(*Object, TEXT("ConvertInSeconds"), ConvertInSeconds / Count, ConvertInCalls > 0u);
+			SetMeasuredField(*Object, TEXT("ConvertOutSeconds"), ConvertOutSeconds / Count, ConvertOutCalls > 0u);
+			Object->SetNumberField(TEXT("ConvertInCalls"), (double)ConvertInCalls / Count);
+			Object->SetNumberField(TEXT("ConvertOutCalls"), (double)ConvertOutCalls / Count);
+			// NOTE: the operation time is the remainder of the entry point time after the recorded conversions,
+			// conversions running concurrently are accumulated and can exceed the entry point time
+			Object->SetNumberField(TEXT("OperationSeconds"), FMath::Max(MeanSeconds - ConvertSeconds, 0.0));
+			Object->SetNumberField(TEXT("InputTriangles"), (double)InputTriangles);
+			Object->SetNumberField(TEXT("OutputTriangles"), (double)OutputTriangles);
+			Object->SetNumberField(TEXT("TrianglesPerSecond"), MeanSeconds > 0.0 ? (double)InputTriangles / MeanSeconds : 0.0);
+			Object->SetNumberField(TEXT("MeshSizeInBytes"), (double)MeshSizeInBytes);
+			// NOTE: the process peak is monotonic, it is sampled at the end of each case
+			Object->SetNumberField(TEXT("PeakUsedPhysicalBytes"), (double)FPlatformMemory::GetStats().PeakUsedPhysical);
+			return Object;
+		}
+
+		static void SetMeasuredField(FJsonObject& Object, const TCHAR* Name, const double Value, const bool bIsMeasured)
+		{
+			if (bIsMeasured)
+			{
+				Object.SetNumberField(Name, Value);
+			}
+			else
+			{
+				Object.SetField(Name, MakeShared<FJsonValueNull>());
+			}
+		}
+
+		void Log() const
+		{
+			const double MeanSeconds = Seconds.Num() > 0 ? Algo::Accumulate(Seconds, 0.0) / Seconds.Num() : 0.0;
+
+			UE_LOG(LogInstaLOD, Display, TEXT("%-22s %-24s %-10s %8.3fs %12llu -> %-12llu %s"),
+				   *Suite, *Input, *Parameter, MeanSeconds, InputTriangles, OutputTriangles, bSuccess ? TEXT("") : TEXT("FAILED"));
+		}
+	};
+
+	/** Overrides an integer console variable for the lifetime of the scope. */
+	class FScopedConsoleVariableOverride
+	{
+	public:
+		FScopedConsoleVariableOverride(const TCHAR* Name, const int32 Value) :
+		Variable(IConsoleManager::Get().FindConsoleVariable(Name)),
+		PreviousValue(0)
+		{
+			if (Variable != nullptr)
+			{
+				PreviousValue = Variable->GetInt();
+				Variable->Set(Value, ECVF_SetByCode);
+			}
+		}
+
+		~FScopedConsoleVariableOverride()
+		{
+			if (Variable != nullptr)
+			{
+				Variable->Set(PreviousValue, ECVF_SetByCode);
+			}
+		}
+
+	private:
+		IConsoleVariable* const Variable;
+		int32 PreviousValue;
+	};
+
+	/**
+	 * Builds a grid mesh of Rows x Columns quads, each split into two triangles.
+	 *
+	 * @param Rows the amount of quad rows.
+	 * @param Columns the amount of quad columns.
+	 * @param GetPosition returns the vertex position for the normalized grid coordinate.
+	 * @param OutMesh the output mesh.
+	 */
+	static void BuildGridMesh(const int32 Rows, const int32 Columns, TFunctionRef<FVector3f(const float U, const float V)> GetPosition, FMeshDescription& OutMesh)
+	{
+		FStaticMeshAttributes Attributes(OutMesh);
+		Attributes.Register();
+
+		TVertexAttributesRef<FVector3f> VertexPositions = Attributes.GetVertexPositions();
+		TVertexInstanceAttributesRef<FVector2f> VertexInstanceUVs = Attributes.GetVertexInstanceUVs();
+		TPolygonGroupAttributesRef<FName> PolygonGroupMaterialSlotNames = Attributes.GetPolygonGroupMaterialSlotNames();
+
+		const int32 VertexCount = (Rows + 1) * (Columns + 1);
+		OutMesh.ReserveNewVertices(VertexCount);
+		OutMesh.ReserveNewVertexInstances(VertexCount);
+		OutMesh.ReserveNewTriangles(Rows * Columns * 2);
+
+		const FPolygonGroupID PolygonGroupID = OutMesh.CreatePolygonGroup();
+		PolygonGroupMaterialSlotNames[PolygonGroupID] = FName(TEXT("MaterialSlot_0"));
+
+		TArray<FVertexInstanceID> VertexInstances;
+		VertexInstances.SetNumUninitialized(VertexCount);
+
+		for (int32 Row = 0; Row <= Rows; Row++)
+		{
+			for (int32 Column = 0; Column <= Columns; Column++)
+			{
+				const float U = (float)Column / Columns;
+				const float V = (float)Row / Rows;
+
+				const FVertexID VertexID = OutMesh.CreateVertex();
+				VertexPositions[VertexID] = GetPosition(U, V);
+
+				const FVertexInstanceID VertexInstanceID = OutMesh.CreateVertexInstance(VertexID);
+				VertexInstanceUVs.Set(VertexInstanceID, 0, FVector2f(U, V));
+				VertexInstances[Row * (Columns + 1) + Column] = VertexInstanceID;
+			}
+		}
+
+		for (int32 Row = 0; Row < Rows; Row++)
+		{
+			for (int32 Column = 0; Column < Columns; Column++)
+			{
+				const FVertexInstanceID Corner00 = VertexInstances[Row * (Columns + 1) + Column];
+				const FVertexInstanceID Corner01 = VertexInstances[Row * (Columns + 1) + Column + 1];
+				const FVertexInstanceID Corner10 = VertexInstances[(Row + 1) * (Columns + 1) + Column];
+				const FVertexInstanceID Corner11 = VertexInstances[(Row + 1) * (Columns + 1) + Column + 1];
+
+				const FVertexInstanceID Triangle0[] = { Corner00, Corner10, Corner11 };
+				const FVertexInstanceID Triangle1[] = { Corner00, Corner11, Corner01 };
+				OutMesh.CreateTriangle(PolygonGroupID, Triangle0);
+				OutMesh.CreateTriangle(PolygonGroupID, Triangle1);
+			}
+		}
+
+		FStaticMeshOperations::ComputeTriangleTangentsAndNormals(OutMesh);
+		FStaticMeshOperations::ComputeTangentsAndNormals(OutMesh, EComputeNTBsFlags::Normals | EComputeNTBsFlags::Tangents | EComputeNTBsFlags::WeightedNTBs);
+	}
+
+	static FVector3f GetSpherePosition(const float U, const float V)
+	{
+		// NOTE: the poles are left open to avoid degenerate triangles
+		const float Latitude = FMath::Lerp(-0.49f, 0.49f, V) * PI;
+		const float Longitude = U * 2.0f * PI;
+		return FVector3f(FMath::Cos(Latitude) * FMath::Cos(Longitude), FMath::Cos(Latitude) * FMath::Sin(Longitude), FMath::Sin(Latitude));
+	}
+
+	/**
+	 * Builds a procedural input mesh.
+	 *
+	 * @param Shape the shape name: Sphere, Terrain or Noise.
+	 * @param Triangles the approximate amount of triangles.
+	 * @param OutMesh the output mesh.
+	 * @return true if the shape is known.
+	 */
+	static bool BuildShape(const FString& Shape, const int32 Triangles, FMeshDescription& OutMesh)
+	{
+		constexpr float Radius = 100.0f;
+
+		if (Shape == TEXT("Sphere"))
+		{
+			const int32 Rows = FMath::Max(FMath::RoundToInt(FMath::Sqrt(Triangles / 4.0f)), 2);
+			BuildGridMesh(Rows, Rows * 2, [](const float U, const float V) { return GetSpherePosition(U, V) * Radius; }, OutMesh);
+			return true;
+		}
+		else if (Shape == TEXT("Terrain"))
+		{
+			const int32 Rows = FMath::Max(FMath::RoundToInt(FMath::Sqrt(Triangles / 2.0f)), 1);
+			BuildGridMesh(Rows, Rows, [](const float U, const float V)
+			{
+				const float Height = FMath::PerlinNoise2D(FVector2D(U, V) * 8.0f) * 0.5f + FMath::PerlinNoise2D(FVector2D(U, V) * 32.0f) * 0.1f;
+				return FVector3f((U - 0.5f) * 20.0f, (V - 0.5f) * 20.0f, Height) * Radius;
+			}, OutMesh);
+			return true;
+		}
+		else if (Shape == TEXT("Noise"))
+		{
+			const int32 Rows = FMath::Max(FMath::RoundToInt(FMath::Sqrt(Triangles / 4.0f)), 2);
+			BuildGridMesh(Rows, Rows * 2, [](const float U, const float V)
+			{
+				const FVector3f Direction = GetSpherePosition(U, V);
+				const float Displacement = 1.0f + FMath::PerlinNoise3D(FVector(Direction) * 4.0f) * 0.25f + FMath::PerlinNoise3D(FVector(Direction) * 16.0f) * 0.05f;
+				return Direction * Radius * Displacement;
+			}, OutMesh);
+			return true;
+		}
+
+		return false;
+	}
+
+	static uint64 GetTriangleCount(const FSkeletalMeshLODModel& LODModel)
+	{
+		uint64 Triangles = 0u;
+
+		for (const FSkelMeshSection& Section : LODModel.Sections)
+		{
+			Triangles += Section.NumTriangles;
+		}
+		return Triangles;
+	}
+
+	/** Removes a transient object created by the benchmark so that it can be garbage collected. */
+	static void DiscardObject(UObject* const Object)
+	{
+		if (Object == nullptr)
+			return;
+
+		Object->ClearFlags(RF_Public | RF_Standalone);
+		Object->MarkAsGarbage();
+	}
+}
+
+UInstaLODBenchmarkCommandlet::UInstaLODBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UInstaLODBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace UEInstaLODBenchmarkHelper;
+
+	FOptions Options;
+	Options.Parse(Params);
+
+	FInstaLODModule& InstaLODModule = FModuleManager::LoadModuleChecked<FInstaLODModule>("InstaLODMeshReduction");
+	InstaLOD::IInstaLOD* const InstaLODAPI = InstaLODModule.GetInstaLODAPI();
+	IMeshReduction* const StaticMeshReduction = InstaLODModule.GetStaticMeshReductionInterface();
+	IMeshReduction* const SkeletalMeshReduction = InstaLODModule.GetSkeletalMeshReductionInterface();
+	IMeshMerging* const MeshMerging = InstaLODModule.GetMeshMergingInterface();
+
+	if (InstaLODAPI == nullptr || StaticMeshReduction == nullptr || MeshMerging == nullptr)
+	{
+		UE_LOG(LogInstaLOD, Error, TEXT("InstaLOD is not available, the benchmark cannot run."));
+		return 1;
+	}
+	if (!InstaLODAPI->IsHostAuthorized())
+	{
+		UE_LOG(LogInstaLOD, Error, TEXT("This machine is not authorized to run InstaLOD. Please authorize this machine before running the benchmark."));
+		return 1;
+	}
+
+	// NOTE: every iteration has to compute its result
+	const FScopedConsoleVariableOverride DisableLODCache(TEXT("InstaLOD.LODCache"), 0);
+	const FScopedConsoleVariableOverride DisableHLODCache(TEXT("InstaLOD.HLODCache"), 0);
+	FInstaLODStats::Reset();
+
+	// gather inputs
+	TArray<FInput> Inputs;
+	TArray<USkeletalMesh*> SkeletalMeshes;
+
+	for (const FString& Shape : Options.Shapes)
+	{
+		FInput& Input = Inputs.AddDefaulted_GetRef();
+		Input.Name = Shape;
+
+		if (!BuildShape(Shape, Options.Triangles, Input.Mesh))
+		{
+			UE_LOG(LogInstaLOD, Warning, TEXT("Unknown benchmark shape '%s'."), *Shape);
+			Inputs.Pop();
+		}
+	}
+
+	if (!Options.AssetPath.IsEmpty())
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+		AssetRegistry.SearchAllAssets(/*bSynchronousSearch:*/ true);
+
+		TArray<FAssetData> Assets;
+		AssetRegistry.GetAssetsByPath(FName(*Options.AssetPath), Assets, /*bRecursive:*/ true);
+
+		for (const FAssetData& Asset : Assets)
+		{
+			UObject* const Object = Asset.GetAsset();
+
+			if (UStaticMesh* const StaticMesh = Cast<UStaticMesh>(Object))
+			{
+				const FMeshDescription* const MeshDescription = StaticMesh->GetMeshDescription(0);
+
+				if (MeshDescription != nullptr)
+				{
+					FInput& Input = Inputs.AddDefaulted_GetRef();
+					Input.Name = Asset.AssetName.ToString();
+					Input.Mesh = *MeshDescription;
+				}
+			}
+			else if (USkeletalMesh* const SkeletalMesh = Cast<USkeletalMesh>(Object))
+			{
+				SkeletalMeshes.Add(SkeletalMesh);
+			}
+		}
+	}
+
+	UE_LOG(LogInstaLOD, Display, TEXT("InstaLOD benchmark: %d mesh inputs, %d skeletal meshes, %d iterations."), Inputs.Num(), SkeletalMeshes.Num(), Options.Iterations);
+
+	TArray<FCase> Cases;
+
+	// ReduceMeshDescription
+	if (!Options.bSkipReduce)
+	{
+		for (const FInput& Input : Inputs)
+		{
+			FOverlappingCorners OverlappingCorners;
+			FStaticMeshOperations::FindOverlappingCorners(OverlappingCorners, Input.Mesh, THRESH_POINTS_ARE_SAME);
+
+			for (const float Percentage : Options.Percentages)
+			{
+				FCase& Case = Cases.AddDefaulted_GetRef();
+				Case.Suite = TEXT("ReduceMeshDescription");
+				Case.Input = Input.Name;
+				Case.Parameter = FString::Printf(TEXT("%.2f"), Percentage);
+				Case.InputTriangles = Input.Mesh.Triangles().Num();
+
+				FMeshReductionSettings ReductionSettings;
+				ReductionSettings.PercentTriangles = Percentage;
+
+				for (int32 Iteration = 0; Iteration < Options.Iterations; Iteration++)
+				{
+					FMeshDescription ReducedMesh;
+					FStaticMeshAttributes(ReducedMesh).Register();
+					float MaxDeviation = 0.0f;
+
+					Case.MeasureIteration([&]()
+					{
+						StaticMeshReduction->ReduceMeshDescription(ReducedMesh, MaxDeviation, Input.Mesh, OverlappingCorners, ReductionSettings);
+						return ReducedMesh.Triangles().Num() > 0;
+					});
+					Case.OutputTriangles = ReducedMesh.Triangles().Num();
+				}
+				Case.Log();
+			}
+		}
+
+		// ReduceMeshDescriptionLODs
+		// NOTE: all percentages are reduced by a single call, serially and concurrently, the input is converted once per call
+		TArray<FMeshReductionSettings> LODReductionSettings;
+		TArray<FString> LODPercentages;
+
+		for (const float Percentage : Options.Percentages)
+		{
+			LODReductionSettings.AddDefaulted_GetRef().PercentTriangles = Percentage;
+			LODPercentages.Add(FString::Printf(TEXT("%.2f"), Percentage));
+		}
+
+		for (const FInput& Input : Inputs)
+		{
+			for (const int32 ParallelLODs : { 0, 1 })
+			{
+				const FScopedConsoleVariableOverride LODMode(TEXT("InstaLOD.ParallelLODs"), ParallelLODs);
+
+				FCase& Case = Cases.AddDefaulted_GetRef();
+				Case.Suite = TEXT("ReduceMeshDescriptionLODs");
+				Case.Input = Input.Name;
+				Case.Parameter = FString::Printf(TEXT("%s %s"), ParallelLODs ? TEXT("Parallel") : TEXT("Serial"), *FString::Join(LODPercentages, TEXT(",")));
+				Case.InputTriangles = Input.Mesh.Triangles().Num();
+
+				for (int32 Iteration = 0; Iteration < Options.Iterations; Iteration++)
+				{
+					TArray<FMeshDescription> ReducedMeshes;
+					TArray<float> MaxDeviations;
+
+					Case.MeasureIteration([&]()
+					{
+						return InstaLODModule.GetInstaLODInterface()->ReduceMeshDescriptionLODs(Input.Mesh, LODReductionSettings, ReducedMeshes, MaxDeviations);
+					});
+
+					// NOTE: the output triangles are the sum of all LODs
+					Case.OutputTriangles = 0u;
+					for (const FMeshDescription& ReducedMesh : ReducedMeshes)
+					{
+						Case.OutputTriangles += ReducedMesh.Triangles().Num();
+					}
+				}
+				Case.Log();
+			}
+		}
+	}
+
+	// skeletal reduce
+	// NOTE: the reductions modify the loaded skeletal meshes in memory only, the packages are never saved
+	if (!Options.bSkipSkeletal && SkeletalMeshReduction != nullptr)
+	{
+		constexpr int32 LODIndex = 1;
+
+		for (USkeletalMesh* const SkeletalMesh : SkeletalMeshes)
+		{
+			FSkeletalMeshModel* const ImportedModel = SkeletalMesh->GetImportedModel();
+
+			if (ImportedModel == nullptr || ImportedModel->LODModels.Num() == 0)
+				continue;
+
+			for (const float Percentage : Options.Percentages)
+			{
+				FCase& Case = Cases.AddDefaulted_GetRef();
+				Case.Suite = TEXT("ReduceSkeletalMesh");
+				Case.Input = SkeletalMesh->GetName();
+				Case.Parameter = FString::Printf(TEXT("%.2f"), Percentage);
+				Case.InputTriangles = GetTriangleCount(ImportedModel->LODModels[0]);
+
+				if (!SkeletalMesh->GetLODInfoArray().IsValidIndex(LODIndex))
+				{
+					SkeletalMesh->AddLODInfo();
+				}
+
+				FSkeletalMeshOptimizationSettings& ReductionSettings = SkeletalMesh->GetLODInfo(LODIndex)->ReductionSettings;
+				ReductionSettings.TerminationCriterion = SMTC_NumOfTriangles;
+				ReductionSettings.NumOfTrianglesPercentage = Percentage;
+				ReductionSettings.BaseLOD = 0;
+
+				for (int32 Iteration = 0; Iteration < Options.Iterations; Iteration++)
+				{
+					Case.MeasureIteration([&]()
+					{
+						return SkeletalMeshReduction->ReduceSkeletalMesh(SkeletalMesh, LODIndex, nullptr);
+					});
+					Case.OutputTriangles = ImportedModel->LODModels.IsValidIndex(LODIndex) ? GetTriangleCount(ImportedModel->LODModels[LODIndex]) : 0u;
+				}
+				Case.Log();
+			}
+		}
+	}
+
+	// ProxyLOD
+	if (!Options.bSkipProxy && Inputs.Num() > 0)
+	{
+		TArray<FMeshMergeData> MergeData;
+		uint64 InputTriangles = 0u;
+
+		for (FInput& Input : Inputs)
+		{
+			FMeshMergeData& Data = MergeData.AddDefaulted_GetRef();
+			Data.RawMesh = &Input.Mesh;
+			InputTriangles += Input.Mesh.Triangles().Num();
+		}
+
+		const TArray<FFlattenMaterial> InputMaterials = { FFlattenMaterial() };
+		const FMeshProxySettings ProxySettings;
+
+		// NOTE: the proxy result is delivered through the completion delegate, restore the engine's binding afterwards
+		const auto PreviousCompleteDelegate = MeshMerging->CompleteDelegate;
+		FMeshDescription ProxyMesh;
+		MeshMerging->CompleteDelegate.BindLambda([&ProxyMesh](const FMeshDescription& OutProxyMesh, const FFlattenMaterial& OutMaterial, const FGuid JobGUID)
+		{
+			ProxyMesh = OutProxyMesh;
+		});
+
+		for (const int32 Remesh : { 0, 1 })
+		{
+			const FScopedConsoleVariableOverride ProxyMode(TEXT("InstaLOD.HLODRemesh"), Remesh);
+
+			FCase& Case = Cases.AddDefaulted_GetRef();
+			Case.Suite = TEXT("ProxyLOD");
+			Case.Input = FString::Printf(TEXT("%d meshes"), Inputs.Num());
+			Case.Parameter = Remesh ? TEXT("Remesh") : TEXT("Merge");
+			Case.InputTriangles = InputTriangles;
+
+			for (int32 Iteration = 0; Iteration < Options.Iterations; Iteration++)
+			{
+				ProxyMesh.Empty();
+
+				Case.MeasureIteration([&]()
+				{
+					MeshMerging->ProxyLOD(MergeData, ProxySettings, InputMaterials, FGuid::NewGuid());
+					return ProxyMesh.Triangles().Num() > 0;
+				});
+				Case.OutputTriangles = ProxyMesh.Triangles().Num();
+			}
+			Case.Log();
+		}
+
+		MeshMerging->CompleteDelegate = PreviousCompleteDelegate;
+	}
+
+	// texture page conversion
+	if (!Options.bSkipTextures)
+	{
+		for (const int32 TextureSize : Options.TextureSizes)
+		{
+			InstaLOD::IInstaLODMaterialData* const MaterialData = InstaLODAPI->AllocMaterialData();
+			InstaLOD::IInstaLODMaterial* const Material = MaterialData->AddMaterialWithID("Benchmark", 0);
+			InstaLOD::IInstaLODTexturePage* const TexturePage = Material->AddTexturePage("Color", InstaLOD::IInstaLODTexturePage::TypeColor,
+																						 InstaLOD::IInstaLODTexturePage::ComponentTypeUInt8,
+																						 InstaLOD::IInstaLODTexturePage::PixelTypeRGBA);
+			TexturePage->Reallocate(TextureSize, TextureSize);
+
+			// NOTE: fill the page with a deterministic pattern, constant pages are not representative
+			{
+				InstaLOD::uint64 ByteCount = 0u;
+				uint8* const Data = TexturePage->GetData(&ByteCount);
+
+				for (InstaLOD::uint64 ByteIndex = 0u; ByteIndex < ByteCount; ByteIndex++)
+				{
+					Data[ByteIndex] = (uint8)((ByteIndex * 2654435761ull) >> 13);
+				}
+			}
+
+			FCase& Case = Cases.AddDefaulted_GetRef();
+			Case.Suite = TEXT("TexturePageConversion");
+			Case.Input = TEXT("RGBA8");
+			Case.Parameter = FString::Printf(TEXT("%dx%d"), TextureSize, TextureSize);
+
+			for (int32 Iteration = 0; Iteration < Options.Iterations; Iteration++)
+			{
+				const FString SaveObjectPath = FString::Printf(TEXT("/Temp/InstaLODBenchmark/T_InstaLODBenchmark_%d_%d"), TextureSize, Iteration);
+
+				UTexture* Texture = nullptr;
+
+				Case.MeasureIteration([&]()
+				{
+					Texture = UInstaLODUtilities::ConvertInstaLODTexturePageToTexture(TexturePage, SaveObjectPath);
+					return Texture != nullptr;
+				});
+				DiscardObject(Texture);
+			}
+			Case.Log();
+
+			InstaLODAPI->DeallocMaterialData(MaterialData);
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	// write report
+	TArray<TSharedPtr<FJsonValue>> CaseValues;
+	bool bSuccess = true;
+
+	for (const FCase& Case : Cases)
+	{
+		CaseValues.Add(MakeShared<FJsonValueObject>(Case.ToJson()));
+		bSuccess &= Case.bSuccess;
+	}
+
+	TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetStringField(TEXT("Version"), StaticMeshReduction->GetVersionString());
+	Report->SetStringField(TEXT("Platform"), FString(FPlatformProperties::IniPlatformName()));
+	Report->SetStringField(TEXT("CPU"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+	Report->SetNumberField(TEXT("LogicalCores"), FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+	Report->SetNumberField(TEXT("Iterations"), Options.Iterations);
+	Report->SetNumberField(TEXT("ProceduralTriangles"), Options.Triangles);
+	Report->SetArrayField(TEXT("Cases"), CaseValues);
+
+	FString ReportString;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ReportString);
+	FJsonSerializer::Serialize(Report, Writer);
+
+	if (FFileHelper::SaveStringToFile(ReportString, *Options.ReportPath))
+	{
+		UE_LOG(LogInstaLOD, Display, TEXT("InstaLOD benchmark report written to '%s'."), *Options.ReportPath);
+	}
+	else
+	{
+		UE_LOG(LogInstaLOD, Error, TEXT("Failed to write InstaLOD benchmark report to '%s'."), *Options.ReportPath);
+		bSuccess = false;
+	}
+
+	UE_LOG(LogInstaLOD, Display, TEXT("%s"), *FInstaLODStats::ToString());
+	return bSuccess ? 0 : 1;
+}
@@ -0,0 +1,42 @@
+/**
+ * InstaLODBenchmarkCommandlet.h (InstaLOD)
+ *
+ * Copyright 2016-2023 InstaLOD GmbH - All Rights Reserved.
+ *
+ * Unauthorized copying of this file, via any medium is strictly prohibited.
+ * This file and all it's contents are proprietary and confidential.
+ *
+ * @file InstaLODBenchmarkCommandlet.h
+ * @copyright 2016-2023 InstaLOD GmbH. All rights reserved.
+ * @section License
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "InstaLODBenchmarkCommandlet.generated.h"
+
+/**
+ * Runs a fixed benchmark suite through the plugin entry points and writes a JSON report.
+ *
+ * Usage: UnrealEditor-Cmd <Project> -run=InstaLODBenchmark [options]
+ *	-Shapes=Sphere,Terrain,Noise	procedural input meshes
+ *	-Triangles=<count>				approximate triangle count of the procedural meshes
+ *	-Percentages=0.5,0.25,0.1		triangle percentages used for the reductions, also reduced as LODs of a single ReduceMeshDescriptionLODs call
+ *	-Assets=/Game/Path				additionally benchmarks the static and skeletal meshes in the path
+ *	-TextureSizes=2048,4096,8192	texture page sizes used for the texture page conversion
+ *	-Iterations=<count>				amount of runs per case
+ *	-Report=<file>					report path, defaults to Saved/InstaLOD/Benchmark-<date>.json
+ *	-SkipReduce, -SkipSkeletal, -SkipProxy, -SkipTextures
+ */
+UCLASS()
+class UInstaLODBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UInstaLODBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
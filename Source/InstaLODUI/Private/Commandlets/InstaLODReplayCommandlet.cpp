@@ -0,0 +1,130 @@
+/**
+ * InstaLODReplayCommandlet.cpp (InstaLOD)
+ *
+ * Copyright 2016-2023 InstaLOD GmbH - All Rights Reserved.
+ *
+ * Unauthorized copying of this file, via any medium is strictly prohibited.
+ * This file and all it's contents are proprietary and confidential.
+ *
+ * @file InstaLODReplayCommandlet.cpp
+ * @copyright 2016-2023 InstaLOD GmbH. All rights reserved.
+ * @section License
+ */
+
+#include "Commandlets/InstaLODReplayCommandlet.h"
+#include "InstaLODUIPCH.h"
+
+#include "InstaLODModule.h"
+#include "InstaLOD/InstaLODCapture.h"
+
+#include "Dom/JsonObject.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+
+UInstaLODReplayCommandlet::UInstaLODReplayCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+	ShowErrorCount = true;
+}
+
+int32 UInstaLODReplayCommandlet::Main(const FString& Params)
+{
+	FString CapturePath = FInstaLODCapture::GetDefaultCaptureRoot();
+	FString ReportPath = FPaths::ProjectSavedDir() / TEXT("InstaLOD") / FString::Printf(TEXT("Replay-%s.json"), *FDateTime::Now().ToString());
+	int32 Iterations = 1;
+
+	FParse::Value(*Params, TEXT("Captures="), CapturePath);
+	FParse::Value(*Params, TEXT("Report="), ReportPath);
+	FParse::Value(*Params, TEXT("Iterations="), Iterations);
+	Iterations = FMath::Max(Iterations, 1);
+
+	FInstaLODModule& InstaLODModule = FModuleManager::LoadModuleChecked<FInstaLODModule>("InstaLODMeshReduction");
+	InstaLOD::IInstaLOD* const InstaLODAPI = InstaLODModule.GetInstaLODAPI();
+
+	if (InstaLODAPI == nullptr)
+	{
+		UE_LOG(LogInstaLOD, Error, TEXT("InstaLOD is not available, the captures cannot be replayed."));
+		return 1;
+	}
+	if (!InstaLODAPI->IsHostAuthorized())
+	{
+		UE_LOG(LogInstaLOD, Error, TEXT("This machine is not authorized to run InstaLOD. Please authorize this machine before replaying captures."));
+		return 1;
+	}
+
+	TArray<FString> CaptureDirectories;
+	FInstaLODCapture::FindCaptures(CapturePath, CaptureDirectories);
+
+	if (CaptureDirectories.Num() == 0)
+	{
+		UE_LOG(LogInstaLOD, Error, TEXT("No InstaLOD captures found in '%s'."), *CapturePath);
+		return 1;
+	}
+
+	UE_LOG(LogInstaLOD, Display, TEXT("Replaying %d InstaLOD captures, %d iterations each."), CaptureDirectories.Num(), Iterations);
+
+	TArray<TSharedPtr<FJsonValue>> CaptureValues;
+	int32 FailureCount = 0;
+
+	for (const FString& CaptureDirectory : CaptureDirectories)
+	{
+		FInstaLODCapture::FReplayResult Result;
+		double TotalSeconds = 0.0;
+		double MinSeconds = TNumericLimits<double>::Max();
+		bool bSuccess = true;
+
+		for (int32 Iteration = 0; Iteration < Iterations && bSuccess; Iteration++)
+		{
+			bSuccess = FInstaLODCapture::Replay(InstaLODAPI, CaptureDirectory, Result);
+			TotalSeconds += Result.WallTimeInSeconds;
+			MinSeconds = FMath::Min(MinSeconds, Result.WallTimeInSeconds);
+		}
+
+		const double MeanSeconds = TotalSeconds / Iterations;
+		const FString CaptureName = FPaths::GetCleanFilename(CaptureDirectory);
+
+		if (bSuccess)
+		{
+			UE_LOG(LogInstaLOD, Display, TEXT("%-64s %-16s %8.3fs %12llu -> %llu"), *CaptureName, *Result.Operation, MeanSeconds, Result.InputTriangles, Result.OutputTriangles);
+		}
+		else
+		{
+			UE_LOG(LogInstaLOD, Error, TEXT("%-64s %-16s %s"), *CaptureName, *Result.Operation, *Result.Error);
+			FailureCount++;
+		}
+
+		TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+		Object->SetStringField(TEXT("Capture"), CaptureName);
+		Object->SetStringField(TEXT("Operation"), Result.Operation);
+		Object->SetBoolField(TEXT("Success"), bSuccess);
+		Object->SetStringField(TEXT("Error"), Result.Error);
+		Object->SetNumberField(TEXT("MeanSeconds"), bSuccess ? MeanSeconds : 0.0);
+		Object->SetNumberField(TEXT("MinSeconds"), bSuccess ? MinSeconds : 0.0);
+		Object->SetNumberField(TEXT("InputTriangles"), (double)Result.InputTriangles);
+		Object->SetNumberField(TEXT("OutputTriangles"), (double)Result.OutputTriangles);
+		Object->SetNumberField(TEXT("TrianglesPerSecond"), bSuccess && MeanSeconds > 0.0 ? (double)Result.InputTriangles / MeanSeconds : 0.0);
+		CaptureValues.Add(MakeShared<FJsonValueObject>(Object));
+	}
+
+	TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetStringField(TEXT("SDKBuildDate"), ANSI_TO_TCHAR(InstaLODAPI->GetBuildDate()));
+	Report->SetNumberField(TEXT("Iterations"), Iterations);
+	Report->SetArrayField(TEXT("Captures"), CaptureValues);
+
+	FString ReportString;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&ReportString);
+	FJsonSerializer::Serialize(Report, Writer);
+
+	if (!FFileHelper::SaveStringToFile(ReportString, *ReportPath))
+	{
+		UE_LOG(LogInstaLOD, Error, TEXT("Failed to write InstaLOD replay report to '%s'."), *ReportPath);
+		return 1;
+	}
+
+	UE_LOG(LogInstaLOD, Display, TEXT("InstaLOD replay report written to '%s', %d of %d captures failed."), *ReportPath, FailureCount, CaptureDirectories.Num());
+	return FailureCount > 0 ? 1 : 0;
+}
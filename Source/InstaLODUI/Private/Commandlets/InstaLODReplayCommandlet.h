@@ -0,0 +1,37 @@
+/**
+ * InstaLODReplayCommandlet.h (InstaLOD)
+ *
+ * Copyright 2016-2023 InstaLOD GmbH - All Rights Reserved.
+ *
+ * Unauthorized copying of this file, via any medium is strictly prohibited.
+ * This file and all it's contents are proprietary and confidential.
+ *
+ * @file InstaLODReplayCommandlet.h
+ * @copyright 2016-2023 InstaLOD GmbH. All rights reserved.
+ * @section License
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "InstaLODReplayCommandlet.generated.h"
+
+/**
+ * Re-executes the captures recorded with 'InstaLOD.Capture' and writes a JSON report with per-capture timings.
+ *
+ * Usage: UnrealEditor-Cmd <Project> -run=InstaLODReplay [options]
+ *	-Captures=<path>	a capture or a directory of captures, defaults to Saved/InstaLOD/Captures
+ *	-Iterations=<count>	amount of runs per capture
+ *	-Report=<file>		report path, defaults to Saved/InstaLOD/Replay-<date>.json
+ */
+UCLASS()
+class UInstaLODReplayCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UInstaLODReplayCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -108,8 +108,8 @@ namespace InstaLODScriptUtilities
 				Mesh->AppendMesh(SubMesh);
 			}
 
-			InstaLODInterface->GetInstaLOD()->DeallocMesh(TempMesh);
-			InstaLODInterface->GetInstaLOD()->DeallocMesh(SubMesh);
+			InstaLODInterface->DeallocInstaLODMesh(TempMesh);
+			InstaLODInterface->DeallocInstaLODMesh(SubMesh);
 		}
 
 		return true;
@@ -362,7 +362,7 @@ UInstaLODScriptResult* UInstaLODScriptWrapper::ImposterizeAssets(const TArray<UO
 	if (Result.Success == true)
 	{
 		const FString Path = TEXT("/Game/") + MaterialSettings->SavePath.Path + TEXT("/") + FGuid::NewGuid().ToString();
-		UMaterialInstanceConstant* const BakeMaterial = UInstaLODUtilities::CreateFlattenMaterialInstanceFromInstaMaterial(Result.BakeMaterial, MaterialSettings->GetFlattenMaterialSettings()->GetMaterialProxySettings(), Path, OutAssetsToSync, Settings.Type == (InstaLOD::ImposterType::Type)EInstaLODImposterizeType::InstaLOD_Flipbook);
+		UMaterialInstanceConstant* const BakeMaterial = UInstaLODUtilities::CreateFlattenMaterialInstanceFromInstaMaterial(Result.BakeMaterial, MaterialSettings->GetFlattenMaterialSettings()->GetMaterialProxySettings(), Path, OutAssetsToSync, Settings.Type == (InstaLOD::ImposterType::Type)EInstaLODImposterizeType::InstaLOD_Flipbook, MaterialSettings->bHighPrecisionTextures);
 
 		if (Settings.Type == (InstaLOD::ImposterType::Type)EInstaLODImposterizeType::InstaLOD_Flipbook)
 		{
@@ -462,7 +462,7 @@ UInstaLODScriptResult* UInstaLODScriptWrapper::MaterialMergeAssets(const TArray<
 	if (Result.Success)
 	{
 		const FString Path = TEXT("/Game/") + MaterialSettings->SavePath.Path + TEXT("/") + FGuid::NewGuid().ToString();
-		UMaterialInstanceConstant* BakeMaterial = UInstaLODUtilities::CreateFlattenMaterialInstanceFromInstaMaterial(Result.MergeMaterial, MaterialSettings->GetFlattenMaterialSettings()->GetMaterialProxySettings(), Path, OutAssetsToSync, /*bIsFlipbookMaterial:*/false);
+		UMaterialInstanceConstant* BakeMaterial = UInstaLODUtilities::CreateFlattenMaterialInstanceFromInstaMaterial(Result.MergeMaterial, MaterialSettings->GetFlattenMaterialSettings()->GetMaterialProxySettings(), Path, OutAssetsToSync, /*bIsFlipbookMaterial:*/false, MaterialSettings->bHighPrecisionTextures);
 
 		ScriptResult->bSuccess = UInstaLODUtilities::FinalizeScriptProcessResult(ValidEntries[0], InstaLODInterface, MeshComponents[0], OutputInstaLODMesh, ResultSettings, ScriptResult->OutResults, BakeMaterial);
 
@@ -636,7 +636,7 @@ UInstaLODScriptResult* UInstaLODScriptWrapper::RemeshAssets(const TArray<UObject
 	{
 		// Generate unique asset string we'll use as temporary save path
 		const FString Path = TEXT("/Game/") + MaterialSettings->SavePath.Path + TEXT("/") + FGuid::NewGuid().ToString();
-		UMaterialInstanceConstant* const BakeMaterial = UInstaLODUtilities::CreateFlattenMaterialInstanceFromInstaMaterial(Result.BakeMaterial, MaterialSettings->GetFlattenMaterialSettings()->GetMaterialProxySettings(), Path, OutAssetsToSync, /*bIsFlipbookMaterial:*/false);
+		UMaterialInstanceConstant* const BakeMaterial = UInstaLODUtilities::CreateFlattenMaterialInstanceFromInstaMaterial(Result.BakeMaterial, MaterialSettings->GetFlattenMaterialSettings()->GetMaterialProxySettings(), Path, OutAssetsToSync, /*bIsFlipbookMaterial:*/false, MaterialSettings->bHighPrecisionTextures);
 		bool bIsSuccessful = UInstaLODUtilities::FinalizeScriptProcessResult(ValidEntries[0], InstaLODInterface, MeshComponents[0], OutputInstaLODMesh, ResultSettings, ScriptResult->OutResults, BakeMaterial, /*bIsFreezingTransformsForMultiSelection:*/true);
 
 		if (bIsSuccessful)
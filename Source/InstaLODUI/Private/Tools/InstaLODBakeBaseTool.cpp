@@ -22,6 +22,7 @@ void UInstaLODBakeBaseTool::ResetSettings()
 	SuperSampling = EInstaLODSuperSampling::InstaLOD_X2;
 	bSolidifyTexturePages = true;
 	AlphaMaskThreshold = 0.5f;
+	bHighPrecisionTextures = false;
 	MaterialSettings = FInstaLODMaterialSettings();
 
 	bBakeTexturePagePositionNormalizeAABB = true;
@@ -181,10 +182,19 @@ bool UInstaLODBakeBaseTool::ReadSettingsFromJSONObject(const TSharedPtr<FJsonObj
 	{
 		AlphaMaskThreshold = (float) BakeOutputSettings->GetNumberField("AlphaMaskThreshold");
 	}
+	if (BakeOutputSettings->HasField("HighPrecisionTextures"))
+	{
+		bHighPrecisionTextures = BakeOutputSettings->GetBoolField("HighPrecisionTextures");
+	}
 
 	return true;
 }
 
+bool UInstaLODBakeBaseTool::IsUsingHighPrecisionTextures() const
+{
+	return bHighPrecisionTextures;
+}
+
 FMaterialProxySettings UInstaLODBakeBaseTool::GetMaterialProxySettings() const
 {
 	FMaterialProxySettings MaterialProxySettings;
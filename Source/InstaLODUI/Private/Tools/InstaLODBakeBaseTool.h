@@ -180,6 +180,10 @@ public:
 	UPROPERTY(Config, EditAnywhere, meta = (DisplayName = "Alpha Mask Threshold", NoSpinbox, UIMin = 0.0f, UIMax = 1.0f, ClampMin = 0.0f, ClampMax = 1.0f), Category = "Bake Output")
 	float AlphaMaskThreshold = 0.5f;
 
+	/** Stores bake texture pages with more than 8 bits per component, e.g. displacement or object-space normals, as 16-bit or half float textures. */
+	UPROPERTY(Config, EditAnywhere, meta = (DisplayName = "High Precision Textures"), Category = "Bake Output")
+	bool bHighPrecisionTextures = false;
+
 	UPROPERTY(Config, EditAnywhere, meta = (DisplayName = "Material Settings"), Category = "Bake Output")
 	FInstaLODMaterialSettings MaterialSettings;
 	
@@ -226,6 +230,7 @@ public:
 	/** Start - UInstaLODBaseTool Interface */
 	virtual void ResetSettings() override;
 	virtual FMaterialProxySettings GetMaterialProxySettings() const override;
+	virtual bool IsUsingHighPrecisionTextures() const override;
 	virtual bool ReadSettingsFromJSONObject(const TSharedPtr<FJsonObject>& JsonObject) override;
 	/** End - UInstaLODBaseTool Interface */
 };
@@ -28,6 +28,7 @@
 #include "ScopedTransaction.h"
 #include "MaterialUtilities.h"
 #include "Misc/ConfigCacheIni.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 #define LOCTEXT_NAMESPACE "InstaLODUI"
 
@@ -261,6 +262,8 @@ void UInstaLODBaseTool::OnMeshOperationError(const FText& Message) const
 
 void UInstaLODBaseTool::ExecuteMeshOperation()
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UInstaLODBaseTool::ExecuteMeshOperation);
+	
 	// clear message log
 	GetInstaLODInterface()->GetInstaLOD()->ClearMessageLog();
 	
@@ -282,7 +285,10 @@ void UInstaLODBaseTool::ExecuteMeshOperation()
 		return;
 	}
 	
-	OnMeshOperationBegin();
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UInstaLODBaseTool::OnMeshOperationBegin);
+		OnMeshOperationBegin();
+	}
 
 	SlowTaskProgress = new FScopedSlowTask(100.0f, NSLOCTEXT(LOCTEXT_NAMESPACE, "OptimizeOperation", "Processing Mesh Operation"));
 	SlowTaskProgress->MakeDialog(true);
@@ -293,9 +299,18 @@ void UInstaLODBaseTool::ExecuteMeshOperation()
 		SlowTaskProgress = nullptr;
 	};
 
-	OnMeshOperationExecute(false);
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UInstaLODBaseTool::OnMeshOperationExecute);
+		FInstaLODScopedStatsSample StatsSample(GetStatsOperation());
+		OnMeshOperationExecute(false);
+		StatsSample.SetMeshes(InputMesh, IsMeshOperationSuccessful() ? OutputMesh : nullptr);
+		StatsSample.Sample.bSuccess = IsMeshOperationSuccessful();
+	}
 
-	OnMeshOperationFinalize();
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(UInstaLODBaseTool::OnMeshOperationFinalize);
+		OnMeshOperationFinalize();
+	}
 }
 
 void UInstaLODBaseTool::OnMeshOperationBegin()
@@ -365,7 +380,7 @@ void UInstaLODBaseTool::OnMeshOperationBegin()
 			}
 
 			// dealloc mesh
-			GetInstaLODInterface()->GetInstaLOD()->DeallocMesh(MergeDataEntry.InstaLODMesh);
+			GetInstaLODInterface()->DeallocInstaLODMesh(MergeDataEntry.InstaLODMesh);
 		}
 	}
 	else
@@ -412,7 +427,7 @@ void UInstaLODBaseTool::OnMeshOperationBegin()
 			}
 		}
 
-		GetInstaLODInterface()->GetInstaLOD()->DeallocMesh(TempMesh);
+		GetInstaLODInterface()->DeallocInstaLODMesh(TempMesh);
 	}
 }
 
@@ -453,7 +468,7 @@ void UInstaLODBaseTool::OnMeshOperationFinalize()
 			bIsImposter = true;
 			if (ImposterizeTool->TargetMesh != nullptr)
 			{
-				GetInstaLODInterface()->GetInstaLOD()->DeallocMesh(ImposterizeTool->TargetMesh);
+				GetInstaLODInterface()->DeallocInstaLODMesh(ImposterizeTool->TargetMesh);
 			}
 		}
 
@@ -520,7 +535,7 @@ void UInstaLODBaseTool::OnMeshOperationFinalize()
 						
 						const FString SaveTexturePagePath = AssetBasePath + TEXT("T_") + AssetBaseName + TEXT("_") + TexturePageName;
 						
-						UTexture *const Texture = UInstaLODUtilities::ConvertInstaLODTexturePageToTexture(TexturePage, SaveTexturePagePath);
+						UTexture *const Texture = UInstaLODUtilities::ConvertInstaLODTexturePageToTexture(TexturePage, SaveTexturePagePath, IsUsingHighPrecisionTextures());
 						
 						if (!Texture)
 						{
@@ -802,7 +817,7 @@ void UInstaLODBaseTool::OnMeshOperationFinalize()
 			
 			if (TempMesh != nullptr)
 			{
-				GetInstaLODInterface()->GetInstaLOD()->DeallocMesh(TempMesh);
+				GetInstaLODInterface()->DeallocInstaLODMesh(TempMesh);
 			}
 		}
 
@@ -840,12 +855,12 @@ void UInstaLODBaseTool::OnMeshOperationFinalize()
 	}
 	if (InputMesh != nullptr)
 	{
-		GetInstaLODInterface()->GetInstaLOD()->DeallocMesh(InputMesh);
+		GetInstaLODInterface()->DeallocInstaLODMesh(InputMesh);
 		InputMesh = nullptr;
 	}
 	if (OutputMesh != nullptr)
 	{
-		GetInstaLODInterface()->GetInstaLOD()->DeallocMesh(OutputMesh);
+		GetInstaLODInterface()->DeallocInstaLODMesh(OutputMesh);
 		OutputMesh = nullptr;
 	}
 	if (Skeleton != nullptr)
@@ -16,6 +16,7 @@
 #include "InstaLOD/InstaLOD.h"
 #include "InstaLOD/InstaLODAPI.h"
 #include "InstaLOD/InstaLODMeshExtended.h"
+#include "InstaLOD/InstaLODStats.h"
 #include "InstaLODUI/Private/InstaLODTypes.h"
 
 #include "CoreMinimal.h"
@@ -131,10 +132,20 @@ public:
 		return false;
 	}
 
+	/** Gets the operation type the mesh operation is recorded as in the InstaLOD session stats. */
+	virtual EInstaLODStatsOperation GetStatsOperation() const {
+		return EInstaLODStatsOperation::MeshTool;
+	}
+
 	virtual InstaLOD::IInstaLODMaterial* GetBakeMaterial() {
 		return nullptr;
 	}
 
+	/** Gets whether bake texture pages with more than 8 bits per component are stored as 16-bit or half float textures. */
+	virtual bool IsUsingHighPrecisionTextures() const {
+		return false;
+	}
+
 	virtual class UAnimSequence* GetBakePose() {
 		return nullptr;
 	}
@@ -532,8 +532,8 @@ bool UInstaLODImposterizeTool::CanAppendMeshToInput(FInstaLODMeshComponent& Comp
 			static_cast<InstaLOD::IInstaLODMeshExtended*>(Mesh)->AppendMesh(SubMesh);
 		}
 		
-		GetInstaLODInterface()->GetInstaLOD()->DeallocMesh(TempMesh);
-		GetInstaLODInterface()->GetInstaLOD()->DeallocMesh(SubMesh);
+		GetInstaLODInterface()->DeallocInstaLODMesh(TempMesh);
+		GetInstaLODInterface()->DeallocInstaLODMesh(SubMesh);
 	}
 	
 	return true;
@@ -194,6 +194,7 @@ public:
 	virtual void OnMeshOperationExecute(bool bIsAsynchronous) override;
 	virtual void DeallocMeshOperation() override;
 	virtual bool IsMeshOperationSuccessful() const override;
+	virtual EInstaLODStatsOperation GetStatsOperation() const override { return EInstaLODStatsOperation::Imposterize; }
 	virtual InstaLOD::IInstaLODMaterial* GetBakeMaterial() override;
 	virtual bool IsMaterialDataRequired() const override {
 		return true;
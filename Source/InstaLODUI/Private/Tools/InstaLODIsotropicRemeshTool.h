@@ -111,6 +111,7 @@ public:
 	virtual void OnMeshOperationExecute(bool bIsAsynchronous) override;
 	virtual void DeallocMeshOperation() override;
 	virtual bool IsMeshOperationSuccessful() const override;
+	virtual EInstaLODStatsOperation GetStatsOperation() const override { return EInstaLODStatsOperation::Remesh; }
 	virtual bool IsMaterialDataRequired() const override {
 		return false;
 	}
@@ -217,6 +217,7 @@ public:
 	virtual void OnMeshOperationExecute(bool bIsAsynchronous) override;
 	virtual void DeallocMeshOperation() override;
 	virtual bool IsMeshOperationSuccessful() const override;
+	virtual EInstaLODStatsOperation GetStatsOperation() const override { return EInstaLODStatsOperation::Optimize; }
 
 	virtual bool ReadSettingsFromJSONObject(const TSharedPtr<FJsonObject>& JsonObject) override;
 	virtual FText GetFriendlyName() const override;
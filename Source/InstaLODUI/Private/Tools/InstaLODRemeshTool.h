@@ -177,6 +177,7 @@ public:
 	virtual void OnMeshOperationExecute(bool bIsAsynchronous) override;
 	virtual void DeallocMeshOperation() override;
 	virtual bool IsMeshOperationSuccessful() const override;
+	virtual EInstaLODStatsOperation GetStatsOperation() const override { return EInstaLODStatsOperation::Remesh; }
 	virtual InstaLOD::IInstaLODMaterial* GetBakeMaterial() override;
 	virtual bool IsMaterialDataRequired() const override {
 		return true;
@@ -15,6 +15,7 @@
 #include "InstaLODUIPCH.h"
 
 #include "InstaLODModule.h"
+#include "InstaLOD/InstaLODTexturePageConversion.h"
 #include "Tools/InstaLODBaseTool.h"
 
 #include "RawMesh.h"
@@ -42,6 +43,7 @@
 #include "Components/StaticMeshComponent.h"
 #include "Rendering/SkeletalMeshModel.h"
 #include "Rendering/SkeletalMeshLODModel.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 #define LOCTEXT_NAMESPACE "InstaLODUI"
 
@@ -543,11 +545,10 @@ class FInstaLODMeshMergeUtilities : public IMeshMergeUtilities
 
 				// we convert our InstaLOD Mesh back into a raw mesh
 				// this way we can operate both on skeletal and static meshes in a unified way
-				// NOTE: flip InstaLODMesh FaceDirections to revert the ReverseFaceDirections in ConvertInstaLODMeshToMeshDescription
+				// NOTE: the mesh description preserves the InstaLOD winding so that its wedges match the RawMesh
 				InstaLOD->ConvertInstaLODMeshToRawMesh(InstaLODMergeData.InstaLODMesh, RawMesh);
-				InstaLODMergeData.InstaLODMesh->ReverseFaceDirections(/*flipNormals:*/ false);
 				InstaLOD->ConvertInstaLODMeshToMeshDescription(InstaLODMergeData.InstaLODMesh, TMap<int32, FName>(),
-				                                               MeshDescription);
+				                                               MeshDescription, EInstaLODWindingMode::Preserve);
 				TMap<uint32 /*Section Material Index*/, uint32 /*Global Section Index*/> MaterialIndexToSection;
 
 				FMeshData MeshSetting;
@@ -755,6 +756,7 @@ void UInstaLODUtilities::CreateMaterialData(class IInstaLOD* InstaLOD, TArray<In
                                             const struct FMaterialProxySettings& InMaterialProxySettings,
                                             TArray<UMaterialInterface*>& OutMaterials)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UInstaLODUtilities::CreateMaterialData);
 	// NOTE: we need to avoid calling the constructor of FMeshMergeUtilities
 	// otherwise it will rebind delegates to the base class and breaking the proxy job processing.
 	// The C cast is a hack, but we're taking care as to not modify the class members or vtable so it should pass
@@ -768,12 +770,22 @@ bool UInstaLODUtilities::WriteInstaLODMessagesToLog(IInstaLOD* InstaLOD)
 {
 	check(InstaLOD);
 
-	char InstaLog[8192];
+	// NOTE: the buffer is sized to the message log, so that long logs aren't truncated
+	InstaLOD::uint64 LogSize = 0u;
+	InstaLOD->GetInstaLOD()->GetMessageLog(nullptr, 0u, &LogSize);
 
-	if (InstaLOD->GetInstaLOD()->GetMessageLog(InstaLog, sizeof(InstaLog), nullptr) == 0)
+	if (LogSize == 0u)
 		return false;
 
-	UE_LOG(LogInstaLOD, Error, TEXT("%s"), UTF8_TO_TCHAR(InstaLog));
+	TArray<ANSICHAR> InstaLog;
+	InstaLog.SetNumZeroed((int32)LogSize + 1);
+
+	if (InstaLOD->GetInstaLOD()->GetMessageLog(InstaLog.GetData(), (InstaLOD::uint64)InstaLog.Num(), nullptr) == 0)
+		return false;
+
+	// NOTE: the log may have grown after querying its size, the buffer is always null terminated
+	InstaLog.Last() = '\0';
+	UE_LOG(LogInstaLOD, Error, TEXT("%s"), UTF8_TO_TCHAR(InstaLog.GetData()));
 
 	return true;
 }
@@ -796,7 +808,7 @@ void UInstaLODUtilities::AppendMeshComponentToInstaLODMesh(IInstaLOD* InstaLOD,
 	if (ExtendedMesh && InstaLODMesh)
 	{
 		ExtendedMesh->AppendMesh(InstaLODMesh);
-		InstaLOD->GetInstaLOD()->DeallocMesh(InstaLODMesh);
+		InstaLOD->DeallocInstaLODMesh(InstaLODMesh);
 	}
 }
 
@@ -1272,7 +1284,7 @@ UMaterialInstanceConstant* UInstaLODUtilities::CreateFlattenMaterialInstance(
 
 UMaterialInstanceConstant* UInstaLODUtilities::CreateFlattenMaterialInstanceFromInstaMaterial(
 	InstaLOD::IInstaLODMaterial* const Material, const FMaterialProxySettings& InMaterialProxySettings,
-	const FString& SaveObjectPath, TArray<UObject*>& OutAssetsToSync, bool bIsFlipbookMaterial)
+	const FString& SaveObjectPath, TArray<UObject*>& OutAssetsToSync, bool bIsFlipbookMaterial, bool bHighPrecisionTextures)
 {
 	FFlattenMaterial FlattenMaterial;
 
@@ -1323,7 +1335,7 @@ UMaterialInstanceConstant* UInstaLODUtilities::CreateFlattenMaterialInstanceFrom
 
 		const FString SaveTexturePagePath = AssetBasePath + TEXT("T_") + AssetBaseName + TEXT("_") + TexturePageName;
 		UTexture* const Texture = UInstaLODUtilities::ConvertInstaLODTexturePageToTexture(
-			TexturePage, SaveTexturePagePath);
+			TexturePage, SaveTexturePagePath, bHighPrecisionTextures);
 
 		if (!Texture)
 		{
@@ -1763,8 +1775,9 @@ void UInstaLODUtilities::TransformInstaLODMesh(InstaLOD::IInstaLODMesh* InstaLOD
 }
 
 UTexture* UInstaLODUtilities::ConvertInstaLODTexturePageToTexture(InstaLOD::IInstaLODTexturePage* InstaLODTexturePage,
-                                                                  const FString& SaveObjectPath)
+                                                                  const FString& SaveObjectPath, const bool bHighPrecision)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UInstaLODUtilities::ConvertInstaLODTexturePageToTexture);
 	check(InstaLODTexturePage);
 
 	const FString AssetBaseName = FPackageName::GetShortName(SaveObjectPath);
@@ -1774,8 +1787,26 @@ UTexture* UInstaLODUtilities::ConvertInstaLODTexturePageToTexture(InstaLOD::IIns
 	const bool bIsSRGB = false;
 	const bool bDither = false;
 
+	const bool bIsGrayscale = InstaLODTexturePage->GetType() == InstaLOD::IInstaLODTexturePage::TypeDisplacementMap ||
+	                          InstaLODTexturePage->GetType() == InstaLOD::IInstaLODTexturePage::TypeCurvatureMap ||
+	                          InstaLODTexturePage->GetType() == InstaLOD::IInstaLODTexturePage::TypeThicknessMap;
+
+	if (bIsGrayscale)
+	{
+		TextureCompression = TC_Grayscale;
+	}
+	else if (InstaLODTexturePage->GetType() == InstaLOD::IInstaLODTexturePage::TypeBentNormals)
+	{
+		TextureCompression = TC_Normalmap;
+	}
+
+	// NOTE: pages with more than 8 bits per component are stored in their native precision
+	if (bHighPrecision && InstaLODTexturePage->GetComponentType() != InstaLOD::IInstaLODTexturePage::ComponentTypeUInt8)
+	{
+		return ConvertInstaLODTexturePageToHighPrecisionTexture(InstaLODTexturePage, SaveObjectPath, TextureCompression);
+	}
+
 	TArray<FColor> PixelData;
-	PixelData.SetNumUninitialized(InstaLODTexturePage->GetWidth() * InstaLODTexturePage->GetHeight());
 
 	// copy samples
 	{
@@ -1784,35 +1815,34 @@ UTexture* UInstaLODUtilities::ConvertInstaLODTexturePageToTexture(InstaLOD::IIns
 			InstaLODTexturePage->Dither(InstaLOD::IInstaLODTexturePage::ComponentTypeUInt8);
 		}
 
-		const uint32 Width = InstaLODTexturePage->GetWidth();
-		const uint32 Height = InstaLODTexturePage->GetHeight();
-
-		FColor* OutData = PixelData.GetData();
-
-		for (uint32 Y = 0u; Y < Height; Y++)
+		// NOTE: the page data is converted in bulk, this is identical to sampling every pixel with SampleFloat
+		if (!FInstaLODTexturePageConversion::ConvertToColor(InstaLODTexturePage, PixelData, /*bFlipY*/false))
 		{
-			for (uint32 X = 0u; X < Width; X++)
-			{
-				const InstaLOD::InstaColorRGBAF32 Color = InstaLODTexturePage->SampleFloat(X, Y);
-				*OutData++ = FLinearColor(Color.R, Color.G, Color.B, Color.A).ToFColor(false);
-			}
+			UE_LOG(LogInstaLOD, Error, TEXT("Unsupported layout of texture page '%s'."), ANSI_TO_TCHAR(InstaLODTexturePage->GetName()));
+			return nullptr;
 		}
 	}
 
-	if (InstaLODTexturePage->GetType() == InstaLOD::IInstaLODTexturePage::TypeDisplacementMap ||
-		InstaLODTexturePage->GetType() == InstaLOD::IInstaLODTexturePage::TypeCurvatureMap ||
-		InstaLODTexturePage->GetType() == InstaLOD::IInstaLODTexturePage::TypeThicknessMap)
-	{
-		TextureCompression = TC_Grayscale;
-	}
-	else if (InstaLODTexturePage->GetType() == InstaLOD::IInstaLODTexturePage::TypeBentNormals)
+	FIntPoint TextureSize(InstaLODTexturePage->GetWidth(), InstaLODTexturePage->GetHeight());
+
+	// NOTE: pages with constant texels are stored as a single texel to save disk space, cook time and texture memory.
+	// Normal maps are never collapsed, a single texel normal map would lose its tangent or object space orientation
+	// and bent normal pages would turn into 1x1 normal map textures.
+	const bool bIsNormalMap = TextureCompression == TC_Normalmap ||
+	                          InstaLODTexturePage->GetType() == InstaLOD::IInstaLODTexturePage::TypeNormalMapTangentSpace ||
+	                          InstaLODTexturePage->GetType() == InstaLOD::IInstaLODTexturePage::TypeNormalMapObjectSpace;
+	FColor ConstantValue;
+	if (!bIsNormalMap && PixelData.Num() > 1 &&
+		FInstaLODTexturePageConversion::FindConstantValue(PixelData, FInstaLODTexturePageConversion::GetConstantPageTolerance(), ConstantValue))
 	{
-		TextureCompression = TC_Normalmap;
+		UE_LOG(LogInstaLOD, Log, TEXT("Texture page '%s' is constant, the texture is collapsed to a single texel."), ANSI_TO_TCHAR(InstaLODTexturePage->GetName()));
+		PixelData.SetNum(1);
+		PixelData[0] = ConstantValue;
+		TextureSize = FIntPoint(1, 1);
 	}
 
 	UTexture2D* const Texture = FMaterialUtilities::CreateTexture(nullptr, AssetBasePath + AssetBaseName,
-	                                                              FIntPoint(InstaLODTexturePage->GetWidth(),
-	                                                                        InstaLODTexturePage->GetHeight()),
+	                                                              TextureSize,
 	                                                              PixelData,
 	                                                              TextureCompression,
 	                                                              TEXTUREGROUP_HierarchicalLOD,
@@ -1826,6 +1856,94 @@ UTexture* UInstaLODUtilities::ConvertInstaLODTexturePageToTexture(InstaLOD::IIns
 	return Texture;
 }
 
+UTexture* UInstaLODUtilities::ConvertInstaLODTexturePageToHighPrecisionTexture(InstaLOD::IInstaLODTexturePage* InstaLODTexturePage,
+                                                                               const FString& SaveObjectPath, TextureCompressionSettings TextureCompression)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UInstaLODUtilities::ConvertInstaLODTexturePageToHighPrecisionTexture);
+	check(InstaLODTexturePage);
+
+	const FString AssetBaseName = FPackageName::GetShortName(SaveObjectPath);
+	const FString AssetBasePath = FPackageName::GetLongPackagePath(SaveObjectPath) + TEXT("/");
+	const bool bIsGrayscale = TextureCompression == TC_Grayscale;
+
+	if (TextureCompression == TC_Default)
+	{
+		TextureCompression = TC_HDR;
+	}
+
+	ETextureSourceFormat SourceFormat = TSF_Invalid;
+	TArray<uint16> Components;
+	TArray<FFloat16Color> HalfTexels;
+	const uint8* SourceData = nullptr;
+
+	// NOTE: 16-bit pages are copied without conversion, only float pages are converted to half precision
+	if (InstaLODTexturePage->GetComponentType() == InstaLOD::IInstaLODTexturePage::ComponentTypeUInt16)
+	{
+		if (bIsGrayscale)
+		{
+			// NOTE: grayscale textures with a G16 source are built as G16
+			SourceFormat = TSF_G16;
+
+			if (FInstaLODTexturePageConversion::ConvertToG16(InstaLODTexturePage, Components, /*bFlipY*/false))
+			{
+				SourceData = (const uint8*)Components.GetData();
+			}
+		}
+		else
+		{
+			SourceFormat = TSF_RGBA16;
+
+			if (FInstaLODTexturePageConversion::ConvertToRGBA16(InstaLODTexturePage, Components, /*bFlipY*/false))
+			{
+				SourceData = (const uint8*)Components.GetData();
+			}
+		}
+	}
+	else
+	{
+		SourceFormat = TSF_RGBA16F;
+
+		if (bIsGrayscale)
+		{
+			// NOTE: grayscale compression quantizes non-G16 sources to 8 bits, the single channel half float format keeps the precision
+			TextureCompression = TC_HalfFloat;
+		}
+
+		if (FInstaLODTexturePageConversion::ConvertToFloat16Color(InstaLODTexturePage, HalfTexels, /*bFlipY*/false))
+		{
+			SourceData = (const uint8*)HalfTexels.GetData();
+		}
+	}
+
+	if (SourceData == nullptr)
+	{
+		UE_LOG(LogInstaLOD, Error, TEXT("Unsupported layout of texture page '%s'."), ANSI_TO_TCHAR(InstaLODTexturePage->GetName()));
+		return nullptr;
+	}
+
+	// NOTE: FMaterialUtilities::CreateTexture only accepts 8-bit texels, the texture is set up with the same package
+	// and defaults as FImageUtils::CreateTexture2D uses for the 8-bit textures: a single source mip, mips generated
+	// from the texture group, no alpha compression and deferred compression.
+	UPackage* const Package = CreatePackage(*(AssetBasePath + AssetBaseName));
+	Package->FullyLoad();
+	Package->Modify();
+
+	UTexture2D* const Texture = NewObject<UTexture2D>(Package, *AssetBaseName, RF_Public | RF_Standalone);
+
+	if (Texture == nullptr)
+		return nullptr;
+
+	Texture->Source.Init(InstaLODTexturePage->GetWidth(), InstaLODTexturePage->GetHeight(), /*NewNumSlices*/1, /*NewNumMips*/1, SourceFormat, SourceData);
+	Texture->CompressionSettings = TextureCompression;
+	Texture->MipGenSettings = TMGS_FromTextureGroup;
+	Texture->CompressionNoAlpha = true;
+	Texture->DeferCompression = true;
+	Texture->LODGroup = TEXTUREGROUP_HierarchicalLOD;
+	Texture->SRGB = false;
+	Texture->PostEditChange();
+	return Texture;
+}
+
 void UInstaLODUtilities::InsertLODToMeshComponent(class IInstaLOD* InstaLOD,
                                                   TSharedPtr<FInstaLODMeshComponent> MeshComponent,
                                                   InstaLOD::IInstaLODMesh* InstaLODMesh, int32 TargetLODIndex,
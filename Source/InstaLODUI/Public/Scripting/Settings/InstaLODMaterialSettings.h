@@ -172,6 +172,10 @@ public:
 	UPROPERTY(BlueprintReadWrite, Config, EditAnywhere, meta = (DisplayName = "Alpha Mask Threshold", NoSpinbox, UIMin = 0.0f, UIMax = 1.0f, ClampMin = 0.0f, ClampMax = 1.0f), Category = "Bake Output")
 		float AlphaMaskThreshold = 0.5f;
 
+	/** Stores bake texture pages with more than 8 bits per component, e.g. displacement or object-space normals, as 16-bit or half float textures. */
+	UPROPERTY(BlueprintReadWrite, Config, EditAnywhere, meta = (DisplayName = "High Precision Textures"), Category = "Bake Output")
+		bool bHighPrecisionTextures = false;
+
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, meta = (DisplayName = "Material Settings"), Category = "Bake Output")
 		UFlattenMaterialSettings* FlattenMaterialSettings;
 
@@ -21,6 +21,7 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "Engine/TextureDefines.h"
 
 struct InstaLODMergeData
 {
@@ -102,9 +103,28 @@ public:
 	static UMaterialInstanceConstant* CreateFlattenMaterialInstance(const FFlattenMaterial& FlattenMaterial, const FMaterialProxySettings& InMaterialProxySettings, const FString& SaveObjectPath, TArray<UObject*>& OutAssetsToSync, bool bIsFlipbookMaterial = false);
 	
 	/**
-	 * FIXME
+	 * Creates a texture asset from an InstaLOD texture page.
+	 * 8-bit textures of pages with constant texels are collapsed to a single texel unless the page is a normal map, see 'InstaLOD.ConstantPageTolerance'.
+	 *
+	 * @param InstaLODTexturePage The texture page.
+	 * @param SaveObjectPath The object path of the texture.
+	 * @param bHighPrecision Whether pages with more than 8 bits per component are stored as 16-bit or half float textures.
+	 * @return The texture or nullptr upon failure.
+	 */
+	static UTexture* ConvertInstaLODTexturePageToTexture(InstaLOD::IInstaLODTexturePage* InstaLODTexturePage, const FString& SaveObjectPath, const bool bHighPrecision = false);
+
+	/**
+	 * Creates a texture asset from an InstaLOD texture page with 16-bit or float components without quantizing the texels to 8 bits.
+	 * 16-bit pages of grayscale maps are stored as G16, other 16-bit pages as RGBA16 and float pages as RGBA16F.
+	 * The texture is set up like the 8-bit textures created with FMaterialUtilities::CreateTexture, only the source format differs.
+	 *
+	 * @param InstaLODTexturePage The texture page.
+	 * @param SaveObjectPath The object path of the texture.
+	 * @param TextureCompression The compression chosen for the page type, TC_Default is stored as TC_HDR.
+	 *							 Grayscale float pages use TC_HalfFloat instead of TC_Grayscale, which would quantize the texels to 8 bits.
+	 * @return The texture or nullptr upon failure.
 	 */
-	static UTexture* ConvertInstaLODTexturePageToTexture(InstaLOD::IInstaLODTexturePage* InstaLODTexturePage, const FString& SaveObjectPath);
+	static UTexture* ConvertInstaLODTexturePageToHighPrecisionTexture(InstaLOD::IInstaLODTexturePage* InstaLODTexturePage, const FString& SaveObjectPath, TextureCompressionSettings TextureCompression);
 
 	/**
 	*	Saves an InstanLOD Mesh into a duplicate of an existing Static-/SkeletalMesh Asset.
@@ -224,10 +244,11 @@ public:
 	 * @param SaveObjectPath Where the material is saved.
 	 * @param OutAssetsToSync Array receiving the material.
 	 * @param bIsFlipbookMaterial Whether it is a material for a flipbook imposter.
+	 * @param bHighPrecisionTextures Whether bake texture pages with more than 8 bits per component are stored as 16-bit or half float textures.
 	 * @param bIsFreezingTransformsForMultiSelection Whether the operation freezes the transform for multi-selection.
 	 * @return The material.
 	 */
-	static UMaterialInstanceConstant* CreateFlattenMaterialInstanceFromInstaMaterial(InstaLOD::IInstaLODMaterial* const Material, const FMaterialProxySettings& InMaterialProxySettings, const FString& SaveObjectPath, TArray<UObject*>& OutAssetsToSync, bool bIsFlipbookMaterial = false);
+	static UMaterialInstanceConstant* CreateFlattenMaterialInstanceFromInstaMaterial(InstaLOD::IInstaLODMaterial* const Material, const FMaterialProxySettings& InMaterialProxySettings, const FString& SaveObjectPath, TArray<UObject*>& OutAssetsToSync, bool bIsFlipbookMaterial = false, bool bHighPrecisionTextures = false);
 
 	/**
 	* Customizes the pivot Position of the output mesh.